@@ -21,6 +21,8 @@ public class AsyncReprojection : ModuleRules
 			{
 				"ApplicationCore",
 				"DeveloperSettings",
+				"InputCore",
+				"Json",
 				"Projects",
 				"RenderCore",
 				"Renderer",
@@ -38,6 +40,13 @@ public class AsyncReprojection : ModuleRules
 			}
 			);
 
-		PrivateDefinitions.Add("ASYNC_REPROJECTION_WITH_XR=0");
+		// Stereo reprojection reads HMD poses through IXRTrackingSystem; without it only the simulated pose source is available.
+		bool bWithXR = Target.Type != TargetType.Server;
+		if (bWithXR)
+		{
+			PrivateDependencyModuleNames.Add("HeadMountedDisplay");
+		}
+
+		PrivateDefinitions.Add("ASYNC_REPROJECTION_WITH_XR=" + (bWithXR ? "1" : "0"));
 	}
 }
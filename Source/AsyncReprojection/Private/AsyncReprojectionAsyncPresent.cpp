@@ -4,15 +4,21 @@
 
 #include "AsyncReprojection.h"
 #include "AsyncReprojectionCVars.h"
+#include "AsyncReprojectionCameraTracker.h"
+#include "AsyncReprojectionForeground.h"
 #include "AsyncReprojectionFrameCache.h"
+#include "AsyncReprojectionViewScheduler.h"
+#include "AsyncReprojectionWarpPass.h"
 
 #include "Engine/Engine.h"
 #include "Engine/GameViewportClient.h"
 #include "Misc/CoreDelegates.h"
+#include "RenderingThread.h"
 
 namespace AsyncReprojectionAsyncPresentPrivate
 {
 	static constexpr uint64 VerboseLogFrameInterval = 120;
+	static constexpr double FrameCacheHousekeepingIntervalSeconds = 1.0;
 }
 
 FAsyncReprojectionAsyncPresent& FAsyncReprojectionAsyncPresent::Get()
@@ -33,6 +39,7 @@ void FAsyncReprojectionAsyncPresent::Startup()
 	bStarted = true;
 	LastWorldRenderTimeSeconds = 0.0;
 	bSkipWorldRenderingThisFrame = false;
+	bForegroundOnlyThisFrame = false;
 	bHasLoggedState = false;
 	LastVerboseLogFrame = 0;
 	LastSuccessfulCompositeTimeSeconds.Store(0.0);
@@ -70,6 +77,12 @@ bool FAsyncReprojectionAsyncPresent::ShouldSkipWorldRendering() const
 	return bSkipWorldRenderingThisFrame;
 }
 
+bool FAsyncReprojectionAsyncPresent::IsForegroundOnlyFrame() const
+{
+	FScopeLock Lock(&StateLock);
+	return bForegroundOnlyThisFrame;
+}
+
 void FAsyncReprojectionAsyncPresent::ReportCacheMiss_RenderThread()
 {
 	bForceWorldRenderNextFrame.Store(true);
@@ -86,24 +99,58 @@ void FAsyncReprojectionAsyncPresent::OnBeginFrame_GameThread()
 
 	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
 	const bool bAsyncPipelineEnabled = CVarState.bAsyncPresent || CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
+
+	// Hitch masking captures without the async pipeline, so the cache is only released once neither uses it.
+	const bool bFrameCacheInUse = bAsyncPipelineEnabled || CVarState.bHitchMask;
+	if (bWasFrameCacheInUse && !bFrameCacheInUse)
+	{
+		ENQUEUE_RENDER_COMMAND(AsyncReprojectionReleaseFrameCache)(
+			[](FRHICommandListImmediate& RHICmdList)
+			{
+				FAsyncReprojectionFrameCache::Get().ReleaseAllTargets_RenderThread();
+			});
+	}
+	bWasFrameCacheInUse = bFrameCacheInUse;
+
+	const double NowSeconds = FPlatformTime::Seconds();
+
+	if (bFrameCacheInUse && (NowSeconds - LastFrameCacheHousekeepingSeconds) >= AsyncReprojectionAsyncPresentPrivate::FrameCacheHousekeepingIntervalSeconds)
+	{
+		LastFrameCacheHousekeepingSeconds = NowSeconds;
+		const float IdleReleaseSeconds = CVarState.FrameCacheIdleReleaseSeconds;
+		ENQUEUE_RENDER_COMMAND(AsyncReprojectionReleaseIdleFrameCache)(
+			[IdleReleaseSeconds](FRHICommandListImmediate& RHICmdList)
+			{
+				FAsyncReprojectionFrameCache::Get().ReleaseIdleTargets_RenderThread(FPlatformTime::Seconds(), IdleReleaseSeconds);
+			});
+	}
+
 	if (!bAsyncPipelineEnabled)
 	{
 		{
 			FScopeLock Lock(&StateLock);
 			bSkipWorldRenderingThisFrame = false;
+			bForegroundOnlyThisFrame = false;
 		}
 
 		RestoreWorldRenderPreference_GameThread();
+		FAsyncReprojectionViewScheduler::Get().Tick_GameThread(CVarState, true);
 		return;
 	}
 
-	const double NowSeconds = FPlatformTime::Seconds();
 	const double PeriodSeconds = 1.0 / FMath::Max(1.0f, CVarState.AsyncPresentTargetWorldRenderFPS);
 
 	bool bEnableWorldRendering = true;
 	const bool bAllowSkipping = CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
-	const bool bHasCachedFrame = FAsyncReprojectionFrameCache::Get().HasCachedFrame_AnyThread(0);
-	const bool bHasUsableCachedFrame = FAsyncReprojectionFrameCache::Get().HasUsableCachedFrame_AnyThread(0, NowSeconds, CVarState.AsyncPresentMaxCacheAgeMs);
+	// Skipping the world is only safe when every split-screen pane can be reconstructed from its own cache.
+	bool bHasCachedFrame = true;
+	bool bHasUsableCachedFrame = true;
+	const int32 NumViewSlots = FMath::Max(1, FAsyncReprojectionCameraTracker::Get().GetNumViewSlots_AnyThread());
+	for (int32 PlayerIndex = 0; PlayerIndex < NumViewSlots; PlayerIndex++)
+	{
+		bHasCachedFrame &= FAsyncReprojectionFrameCache::Get().HasCachedFrame_AnyThread(PlayerIndex);
+		bHasUsableCachedFrame &= FAsyncReprojectionFrameCache::Get().HasUsableCachedFrame_AnyThread(PlayerIndex, NowSeconds, CVarState.AsyncPresentMaxCacheAgeMs);
+	}
 	const bool bForceWorldRender = bForceWorldRenderNextFrame.Exchange(false);
 	const double LastCompositeSuccessSeconds = LastSuccessfulCompositeTimeSeconds.Load();
 	const double MaxCompositeStaleSeconds = FMath::Max(2.0 * PeriodSeconds, 0.1);
@@ -143,13 +190,19 @@ void FAsyncReprojectionAsyncPresent::OnBeginFrame_GameThread()
 		LastWorldRenderTimeSeconds = NowSeconds;
 	}
 
-	ApplyWorldRenderPreference_GameThread(bEnableWorldRendering);
+	// A skipped frame still builds the view family when it has a foreground layer to draw over the cached warp.
+	const bool bForegroundOnly = !bEnableWorldRendering && CVarState.bForeground && FAsyncReprojectionForeground::Get().HasForegroundPrimitives_GameThread();
+	ApplyWorldRenderPreference_GameThread(bEnableWorldRendering || bForegroundOnly);
 
 	{
 		FScopeLock Lock(&StateLock);
 		bSkipWorldRenderingThisFrame = !bEnableWorldRendering;
+		bForegroundOnlyThisFrame = bForegroundOnly;
 	}
 
+	// Scene captures are decimated on their own cadence, or with the world when they have none.
+	FAsyncReprojectionViewScheduler::Get().Tick_GameThread(CVarState, bEnableWorldRendering);
+
 	const bool bSkipWorld = !bEnableWorldRendering;
 	if (!bHasLoggedState || bLastLoggedSkipWorldRendering != bSkipWorld || bLastLoggedHasCache != bHasCachedFrame)
 	{
@@ -175,8 +228,9 @@ void FAsyncReprojectionAsyncPresent::OnBeginFrame_GameThread()
 		UE_LOG(
 			LogAsyncReprojection,
 			Verbose,
-			TEXT("AsyncPresent tick: SkipWorld=%d HasCache=%d PeriodMs=%.2f"),
+			TEXT("AsyncPresent tick: SkipWorld=%d ForegroundOnly=%d HasCache=%d PeriodMs=%.2f"),
 			bSkipWorld ? 1 : 0,
+			bForegroundOnly ? 1 : 0,
 			bHasCachedFrame ? 1 : 0,
 			PeriodSeconds * 1000.0);
 		LastVerboseLogFrame = GFrameCounter;
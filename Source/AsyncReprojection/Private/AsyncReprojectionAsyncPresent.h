@@ -22,6 +22,13 @@ public:
 	 */
 	bool ShouldSkipWorldRendering() const;
 
+	/**
+	 * Returns true if this frame skips the world but still renders the foreground layer through the view family
+	 * (r.AsyncReprojection.Foreground). The view family composites the cached warp itself, so the present paths leave
+	 * such frames alone. Implies ShouldSkipWorldRendering().
+	 */
+	bool IsForegroundOnlyFrame() const;
+
 	/**
 	 * Signals that a skipped async-present frame could not use cached resources on the render thread.
 	 * The next game-thread frame will force world rendering to re-prime the cache.
@@ -48,8 +55,12 @@ private:
 	bool bCachedStateValid = false;
 
 	bool bSkipWorldRenderingThisFrame = false;
+	bool bForegroundOnlyThisFrame = false;
 	double LastWorldRenderTimeSeconds = 0.0;
 
+	bool bWasFrameCacheInUse = false;
+	double LastFrameCacheHousekeepingSeconds = 0.0;
+
 	bool bCachedDisableWorldRendering = false;
 	bool bCachedShowFlagGame = true;
 	bool bCachedShowFlagRendering = true;
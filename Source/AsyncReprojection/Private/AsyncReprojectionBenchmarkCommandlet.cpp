@@ -0,0 +1,352 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#include "AsyncReprojectionBenchmarkCommandlet.h"
+
+#include "AsyncReprojection.h"
+#include "AsyncReprojectionCVars.h"
+#include "AsyncReprojectionWarpBenchmark.h"
+#include "AsyncReprojectionWarpPass.h"
+
+#include "Dom/JsonObject.h"
+#include "DynamicRHI.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RenderGraphBuilder.h"
+#include "RenderingThread.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace AsyncReprojectionBenchmarkPrivate
+{
+	static constexpr int32 JsonVersion = 1;
+	static constexpr int32 DefaultIterations = 100;
+	static constexpr int32 DefaultSoftwareIterations = 3;
+
+	struct FResolution
+	{
+		const TCHAR* Name;
+		FIntPoint Extent;
+	};
+
+	static const FResolution Resolutions[] =
+	{
+		{ TEXT("1080p"), FIntPoint(1920, 1080) },
+		{ TEXT("1440p"), FIntPoint(2560, 1440) },
+		{ TEXT("4K"), FIntPoint(3840, 2160) },
+	};
+
+	static const EAsyncReprojectionBenchmarkKernel Kernels[] =
+	{
+		EAsyncReprojectionBenchmarkKernel::PresentWarp,
+		EAsyncReprojectionBenchmarkKernel::CachedWarp,
+		EAsyncReprojectionBenchmarkKernel::CachedWarpComposite,
+	};
+
+	/**
+	 * @struct FCaseResult
+	 *
+	 * Per-warp timings of one kernel, permutation and resolution; negative when not measured.
+	 */
+	struct FCaseResult
+	{
+		EAsyncReprojectionBenchmarkKernel Kernel = EAsyncReprojectionBenchmarkKernel::PresentWarp;
+		FAsyncReprojectionBenchmarkPermutation Permutation;
+		const FResolution* Resolution = nullptr;
+		int32 Iterations = 0;
+		double CpuSetupMs = -1.0;
+		double GpuMs = -1.0;
+		int32 SoftwareIterations = 0;
+		double SoftwareMs = -1.0;
+	};
+
+	/** Comma-separated names of Options to run; all of them when Filter is empty. */
+	template<typename TOption, typename TNameOf>
+	static TArray<TOption> FilterByName(TConstArrayView<TOption> Options, const FString& Filter, TNameOf&& NameOf)
+	{
+		if (Filter.IsEmpty())
+		{
+			return TArray<TOption>(Options);
+		}
+
+		TArray<FString> Names;
+		Filter.ParseIntoArray(Names, TEXT(","));
+
+		TArray<TOption> Selected;
+		for (const TOption& Option : Options)
+		{
+			if (Names.ContainsByPredicate([&Option, &NameOf](const FString& Name) { return Name.Equals(NameOf(Option), ESearchCase::IgnoreCase); }))
+			{
+				Selected.Add(Option);
+			}
+		}
+		return Selected;
+	}
+
+	/** The rotation-only present warp has no permutations; the cached kernels run every present-time combination. */
+	static TArray<FAsyncReprojectionBenchmarkPermutation> GetPermutations(EAsyncReprojectionBenchmarkKernel Kernel)
+	{
+		TArray<FAsyncReprojectionBenchmarkPermutation> Permutations;
+		if (Kernel == EAsyncReprojectionBenchmarkKernel::PresentWarp)
+		{
+			Permutations.AddDefaulted();
+			return Permutations;
+		}
+
+		for (uint32 Bits = 0; Bits < 32; Bits++)
+		{
+			FAsyncReprojectionBenchmarkPermutation& Permutation = Permutations.AddDefaulted_GetRef();
+			Permutation.bTranslation = (Bits & 1u) != 0;
+			Permutation.bStretchBorders = (Bits & 2u) != 0;
+			Permutation.bOcclusionFallback = (Bits & 4u) != 0;
+			Permutation.bObjectMotion = (Bits & 8u) != 0;
+			Permutation.bFarField = (Bits & 16u) != 0;
+		}
+
+		// Cases whose permutations were not compiled for this platform cannot run.
+		Permutations.RemoveAll([](const FAsyncReprojectionBenchmarkPermutation& Permutation)
+		{
+			return (Permutation.bObjectMotion && !FAsyncReprojectionCVars::CanUseObjectMotionPermutations())
+				|| (Permutation.bFarField && !FAsyncReprojectionCVars::CanUseFarFieldPermutations());
+		});
+		return Permutations;
+	}
+
+	static bool CanRunOnGPU()
+	{
+		return FApp::CanEverRender() && GDynamicRHI != nullptr && !GUsingNullRHI;
+	}
+
+	static float GetUiMaskThreshold()
+	{
+		static const auto CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.AsyncReprojection.AsyncPresent.HUDMaskThreshold"));
+		return CVar != nullptr ? CVar->GetFloat() : 0.08f;
+	}
+
+	static void AddTimestampPass(FRDGBuilder& GraphBuilder, FRHIRenderQuery* Query)
+	{
+		GraphBuilder.AddPass(
+			RDG_EVENT_NAME("AsyncReprojection Benchmark Timestamp"),
+			ERDGPassFlags::NeverCull,
+			[Query](FRHICommandListImmediate& RHICmdList)
+			{
+				RHICmdList.EndRenderQuery(Query);
+			});
+	}
+
+	/**
+	 * Records Iterations warps into one graph between two GPU timestamps, after a warm-up graph so shader and pipeline
+	 * creation are not timed. Waits for the timestamps, which is acceptable in a benchmark.
+	 */
+	static void RunGPUCase_RenderThread(
+		FRHICommandListImmediate& RHICmdList,
+		const FAsyncReprojectionBenchmarkView& View,
+		const FAsyncReprojectionBenchmarkTargets& Targets,
+		FCaseResult& Result)
+	{
+		{
+			FRDGBuilder GraphBuilder(RHICmdList);
+			AsyncReprojectionWarpBenchmark::AddKernelPass(GraphBuilder, Result.Kernel, Result.Permutation, View, Targets);
+			GraphBuilder.Execute();
+		}
+
+		FRenderQueryRHIRef BeginQuery = RHICreateRenderQuery(RQT_AbsoluteTime);
+		FRenderQueryRHIRef EndQuery = RHICreateRenderQuery(RQT_AbsoluteTime);
+
+		const double SetupStartSeconds = FPlatformTime::Seconds();
+		{
+			FRDGBuilder GraphBuilder(RHICmdList);
+			AddTimestampPass(GraphBuilder, BeginQuery);
+			for (int32 Iteration = 0; Iteration < Result.Iterations; Iteration++)
+			{
+				AsyncReprojectionWarpBenchmark::AddKernelPass(GraphBuilder, Result.Kernel, Result.Permutation, View, Targets);
+			}
+			AddTimestampPass(GraphBuilder, EndQuery);
+			GraphBuilder.Execute();
+		}
+		Result.CpuSetupMs = (FPlatformTime::Seconds() - SetupStartSeconds) * 1000.0 / double(Result.Iterations);
+
+		RHICmdList.ImmediateFlush(EImmediateFlushType::FlushRHIThread);
+
+		uint64 BeginMicroseconds = 0;
+		uint64 EndMicroseconds = 0;
+		if (RHIGetRenderQueryResult(BeginQuery, BeginMicroseconds, true) && RHIGetRenderQueryResult(EndQuery, EndMicroseconds, true) && EndMicroseconds >= BeginMicroseconds)
+		{
+			Result.GpuMs = double(EndMicroseconds - BeginMicroseconds) / 1000.0 / double(Result.Iterations);
+		}
+	}
+
+	static void RunSoftwareCase(const FAsyncReprojectionBenchmarkView& View, const FAsyncReprojectionBenchmarkScene& Scene, FCaseResult& Result)
+	{
+		TArray<FLinearColor> Output;
+		AsyncReprojectionWarpBenchmark::RunReferenceKernel(Result.Kernel, Result.Permutation, View, Scene, Output);
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Result.SoftwareIterations; Iteration++)
+		{
+			AsyncReprojectionWarpBenchmark::RunReferenceKernel(Result.Kernel, Result.Permutation, View, Scene, Output);
+		}
+		Result.SoftwareMs = (FPlatformTime::Seconds() - StartSeconds) * 1000.0 / double(Result.SoftwareIterations);
+	}
+
+	static TSharedRef<FJsonObject> ToJson(const FCaseResult& Result)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("Kernel"), LexToString(Result.Kernel));
+		Object->SetStringField(TEXT("Permutation"), Result.Permutation.ToString());
+		Object->SetStringField(TEXT("Resolution"), Result.Resolution->Name);
+		Object->SetNumberField(TEXT("Width"), Result.Resolution->Extent.X);
+		Object->SetNumberField(TEXT("Height"), Result.Resolution->Extent.Y);
+		if (Result.GpuMs >= 0.0)
+		{
+			Object->SetNumberField(TEXT("Iterations"), Result.Iterations);
+			Object->SetNumberField(TEXT("CpuSetupMs"), Result.CpuSetupMs);
+			Object->SetNumberField(TEXT("GpuMs"), Result.GpuMs);
+		}
+		if (Result.SoftwareMs >= 0.0)
+		{
+			Object->SetNumberField(TEXT("SoftwareIterations"), Result.SoftwareIterations);
+			Object->SetNumberField(TEXT("SoftwareMs"), Result.SoftwareMs);
+		}
+		return Object;
+	}
+
+	static TSharedRef<FJsonObject> MakeEnvironmentJson(bool bGPU)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+		Object->SetStringField(TEXT("BuildConfiguration"), LexToString(FApp::GetBuildConfiguration()));
+		Object->SetStringField(TEXT("Platform"), FPlatformProperties::PlatformName());
+		Object->SetStringField(TEXT("CPU"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+		Object->SetNumberField(TEXT("CPUCores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+		Object->SetStringField(TEXT("RHI"), bGPU ? GDynamicRHI->GetName() : TEXT("None"));
+		Object->SetStringField(TEXT("GPU"), bGPU ? GRHIAdapterName : FString());
+		return Object;
+	}
+}
+
+UAsyncReprojectionBenchmarkCommandlet::UAsyncReprojectionBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAsyncReprojectionBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace AsyncReprojectionBenchmarkPrivate;
+
+	int32 Iterations = DefaultIterations;
+	int32 SoftwareIterations = DefaultSoftwareIterations;
+	FString ResolutionFilter;
+	FString KernelFilter;
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AsyncReprojection"), TEXT("WarpBenchmark.json"));
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	FParse::Value(*Params, TEXT("SoftwareIterations="), SoftwareIterations);
+	FParse::Value(*Params, TEXT("Resolutions="), ResolutionFilter);
+	FParse::Value(*Params, TEXT("Kernels="), KernelFilter);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	Iterations = FMath::Max(1, Iterations);
+	SoftwareIterations = FMath::Max(1, SoftwareIterations);
+
+	const bool bGPU = CanRunOnGPU();
+	const bool bSoftware = !bGPU || FParse::Param(*Params, TEXT("Software"));
+	if (!bGPU)
+	{
+		UE_LOG(LogAsyncReprojection, Display, TEXT("Benchmark: no GPU available (run with -AllowCommandletRendering for GPU timings); timing the software kernels only."));
+	}
+
+	const TArray<FResolution> SelectedResolutions = FilterByName(MakeArrayView(Resolutions), ResolutionFilter, [](const FResolution& Resolution) { return Resolution.Name; });
+	const TArray<EAsyncReprojectionBenchmarkKernel> SelectedKernels = FilterByName(MakeArrayView(Kernels), KernelFilter, [](EAsyncReprojectionBenchmarkKernel Kernel) { return LexToString(Kernel); });
+	if (SelectedResolutions.IsEmpty() || SelectedKernels.IsEmpty())
+	{
+		UE_LOG(LogAsyncReprojection, Error, TEXT("Benchmark: no resolution or kernel matches -Resolutions=%s -Kernels=%s."), *ResolutionFilter, *KernelFilter);
+		return 1;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> ResultValues;
+	for (const FResolution& Resolution : SelectedResolutions)
+	{
+		FAsyncReprojectionBenchmarkView View = FAsyncReprojectionBenchmarkView::Make(Resolution.Extent);
+		View.UiMaskThreshold = GetUiMaskThreshold();
+		const FAsyncReprojectionBenchmarkScene Scene = FAsyncReprojectionBenchmarkScene::Make(Resolution.Extent);
+
+		FAsyncReprojectionBenchmarkTargets Targets;
+		if (bGPU)
+		{
+			ENQUEUE_RENDER_COMMAND(AsyncReprojectionBenchmarkUpload)([&Targets, &Scene](FRHICommandListImmediate& RHICmdList)
+			{
+				Targets.Upload_RenderThread(RHICmdList, Scene);
+			});
+		}
+
+		for (const EAsyncReprojectionBenchmarkKernel Kernel : SelectedKernels)
+		{
+			for (const FAsyncReprojectionBenchmarkPermutation& Permutation : GetPermutations(Kernel))
+			{
+				FCaseResult Result;
+				Result.Kernel = Kernel;
+				Result.Permutation = Permutation;
+				Result.Resolution = &Resolution;
+				Result.Iterations = Iterations;
+				Result.SoftwareIterations = SoftwareIterations;
+
+				if (bGPU)
+				{
+					ENQUEUE_RENDER_COMMAND(AsyncReprojectionBenchmarkRun)([&View, &Targets, &Result](FRHICommandListImmediate& RHICmdList)
+					{
+						RunGPUCase_RenderThread(RHICmdList, View, Targets, Result);
+					});
+					FlushRenderingCommands();
+				}
+				if (bSoftware)
+				{
+					RunSoftwareCase(View, Scene, Result);
+				}
+
+				UE_LOG(
+					LogAsyncReprojection,
+					Display,
+					TEXT("Benchmark %s %s %s: CpuSetup=%.4fms Gpu=%.4fms Software=%.3fms"),
+					LexToString(Kernel),
+					*Permutation.ToString(),
+					Resolution.Name,
+					Result.CpuSetupMs,
+					Result.GpuMs,
+					Result.SoftwareMs);
+
+				ResultValues.Add(MakeShared<FJsonValueObject>(ToJson(Result)));
+			}
+		}
+
+		if (bGPU)
+		{
+			ENQUEUE_RENDER_COMMAND(AsyncReprojectionBenchmarkRelease)([&Targets](FRHICommandListImmediate&)
+			{
+				Targets = FAsyncReprojectionBenchmarkTargets();
+			});
+			FlushRenderingCommands();
+		}
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("Version"), JsonVersion);
+	Root->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+	Root->SetObjectField(TEXT("Environment"), MakeEnvironmentJson(bGPU));
+	Root->SetArrayField(TEXT("Results"), ResultValues);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	if (!FJsonSerializer::Serialize(Root, Writer) || !FFileHelper::SaveStringToFile(Json, *OutputPath))
+	{
+		UE_LOG(LogAsyncReprojection, Error, TEXT("Benchmark: failed to write %s."), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogAsyncReprojection, Display, TEXT("Benchmark: wrote %d results to %s."), ResultValues.Num(), *OutputPath);
+	return 0;
+}
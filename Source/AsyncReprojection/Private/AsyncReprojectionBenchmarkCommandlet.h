@@ -0,0 +1,30 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "AsyncReprojectionBenchmarkCommandlet.generated.h"
+
+/**
+ * @class UAsyncReprojectionBenchmarkCommandlet
+ *
+ * Times the PresentWarp, CachedWarp and CachedWarpComposite kernels on a synthetic frame at 1080p, 1440p and 4K for
+ * every present-time permutation, and writes the results as JSON for build-over-build comparison.
+ * With -AllowCommandletRendering and a GPU, each case reports CPU setup and GPU time per warp; otherwise, or with
+ * -Software, the CPU reference implementation of the same kernel is timed instead.
+ *
+ * Usage: -run=AsyncReprojectionBenchmark [-Iterations=100] [-SoftwareIterations=3] [-Resolutions=1080p,1440p,4K]
+ *        [-Kernels=PresentWarp,CachedWarp,CachedWarpComposite] [-Output=<path>] [-Software]
+ */
+UCLASS()
+class UAsyncReprojectionBenchmarkCommandlet final : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAsyncReprojectionBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
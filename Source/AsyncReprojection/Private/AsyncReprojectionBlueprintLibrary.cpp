@@ -3,6 +3,9 @@
 #include "AsyncReprojectionBlueprintLibrary.h"
 
 #include "AsyncReprojectionCameraTracker.h"
+#include "AsyncReprojectionForeground.h"
+
+#include "Components/PrimitiveComponent.h"
 
 void UAsyncReprojectionBlueprintLibrary::GetAsyncReprojectionLatestCameraTransform(const UObject* WorldContextObject, int32 PlayerIndex, FTransform& OutTransform, bool& bOutValid)
 {
@@ -50,3 +53,20 @@ void UAsyncReprojectionBlueprintLibrary::SubmitAsyncReprojectionLatestCameraTran
 
 	FAsyncReprojectionCameraTracker::Get().SubmitLatestCameraTransform_GameThread(PlayerIndex, CameraTransform);
 }
+
+void UAsyncReprojectionBlueprintLibrary::SetAsyncReprojectionForegroundComponent(UPrimitiveComponent* Component, bool bForeground)
+{
+	if (Component == nullptr)
+	{
+		return;
+	}
+
+	if (bForeground)
+	{
+		Component->ComponentTags.AddUnique(FAsyncReprojectionForeground::ComponentTag);
+	}
+	else
+	{
+		Component->ComponentTags.Remove(FAsyncReprojectionForeground::ComponentTag);
+	}
+}
@@ -2,6 +2,7 @@
 
 #include "AsyncReprojectionCVars.h"
 
+#include "AsyncReprojectionInputCalibration.h"
 #include "AsyncReprojectionSettings.h"
 
 #include "HAL/IConsoleManager.h"
@@ -113,6 +114,214 @@ namespace AsyncReprojectionCVars
 		TEXT("Async Present: use local depth-based neighbor fallback to reduce disocclusion holes.\n"),
 		ECVF_RenderThreadSafe);
 
+	static TAutoConsoleVariable<int32> CVarAsyncPresentObjectMotion(
+		TEXT("r.AsyncReprojection.AsyncPresent.ObjectMotion"),
+		1,
+		TEXT("Async Present: capture object motion from the velocity buffer and extrapolate moving objects on cached frames.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarAsyncPresentObjectMotionMaxMs(
+		TEXT("r.AsyncReprojection.AsyncPresent.ObjectMotionMaxMs"),
+		100,
+		TEXT("Async Present: longest time object motion is extrapolated past the capture; objects hold position after this.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarAsyncPresentGPUWarpParams(
+		TEXT("r.AsyncReprojection.AsyncPresent.GPUWarpParams"),
+		0,
+		TEXT("Async Present: upload raw poses and input totals and derive the clamped cached-warp matrices and weight in a compute pass.\n")
+		TEXT("Poses are latched when the graph uploads its buffers rather than when the warp passes are recorded.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarCompositor(
+		TEXT("r.AsyncReprojection.Compositor"),
+		0,
+		TEXT("If enabled, a compositor thread keeps the game viewport presenting warped cached frames at display refresh while the game thread stalls.\n")
+		TEXT("Slate UI is not drawn during a stall. Requires a separate rendering thread.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarCompositorStallRefreshIntervals(
+		TEXT("r.AsyncReprojection.Compositor.StallRefreshIntervals"),
+		1.5f,
+		TEXT("Compositor: refresh intervals without a Slate present before the compositor presents (minimum 1).\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarHitchMask(
+		TEXT("r.AsyncReprojection.HitchMask"),
+		0,
+		TEXT("If enabled, the compositor thread presents rotation-only warps of the last cached frame while a world frame is overdue\n")
+		TEXT("(game-thread stalls: streaming flushes, GC, blocking loads, game-thread shader map waits). Stalls of the rendering or RHI\n")
+		TEXT("thread, such as shader and PSO compiles on those threads, are not masked: the present runs on the rendering thread.\n")
+		TEXT("Keeps the frame cache captured even in FullRender without AsyncPresent.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarHitchMaskFrameTimeMultiplier(
+		TEXT("r.AsyncReprojection.HitchMask.FrameTimeMultiplier"),
+		3.0f,
+		TEXT("HitchMask: a world frame is overdue once no frame was captured for this many tracked frame times.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarHitchMaskMinMs(
+		TEXT("r.AsyncReprojection.HitchMask.MinMs"),
+		50.0f,
+		TEXT("HitchMask: shortest capture gap (ms) treated as a hitch, whatever the frame rate.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarHitchMaskMaxSeconds(
+		TEXT("r.AsyncReprojection.HitchMask.MaxSeconds"),
+		5.0f,
+		TEXT("HitchMask: once the last cached frame is older than this, masking stops and the display holds its last image.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarOverscan(
+		TEXT("r.AsyncReprojection.Overscan"),
+		0,
+		TEXT("If enabled, game views are rendered with a FOV margin that follows the camera's angular speed and cropped back to the display FOV,\n")
+		TEXT("so cached warps sample real pixels from the margin instead of revealing borders. Costs central pixel density while the margin is open.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarOverscanMinDegrees(
+		TEXT("r.AsyncReprojection.Overscan.MinDegrees"),
+		0.0f,
+		TEXT("Overscan: margin (degrees per side, horizontal) kept even while the camera is still.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarOverscanMaxDegrees(
+		TEXT("r.AsyncReprojection.Overscan.MaxDegrees"),
+		5.0f,
+		TEXT("Overscan: largest margin (degrees per side, horizontal).\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarOverscanLookaheadMs(
+		TEXT("r.AsyncReprojection.Overscan.LookaheadMs"),
+		100.0f,
+		TEXT("Overscan: the margin covers the camera's angular speed over this many milliseconds of warping.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarFarField(
+		TEXT("r.AsyncReprojection.FarField"),
+		0,
+		TEXT("If enabled, every capture also updates a low-resolution octahedral map of distant content around each view, which the cached warp\n")
+		TEXT("samples where a rotation reaches beyond the cached frame. Lets FreezeAndWarp and long decimation intervals turn without borders.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarFarFieldResolution(
+		TEXT("r.AsyncReprojection.FarField.Resolution"),
+		256,
+		TEXT("FarField: edge length of the octahedral map in texels (32-2048).\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarFarFieldMinDistanceCm(
+		TEXT("r.AsyncReprojection.FarField.MinDistanceCm"),
+		20000.0f,
+		TEXT("FarField: only content at least this far from the camera (and the sky) enters the map. The map is cleared once the camera moves\n")
+		TEXT("far enough for this distance to show a degree of parallax.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarForeground(
+		TEXT("r.AsyncReprojection.Foreground"),
+		0,
+		TEXT("If enabled, frames that skip world rendering still render the primitives tagged AsyncReprojectionForeground (first-person\n")
+		TEXT("weapon and hands) with the latest camera and composite them over the cached warp, so camera-attached geometry is never warped.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarSecondaryViews(
+		TEXT("r.AsyncReprojection.SecondaryViews"),
+		0,
+		TEXT("If enabled, game-world scene captures that capture every frame are decimated with the async pipeline instead of rendering at\n")
+		TEXT("full rate; their render targets keep the last capture in between. Planar reflections are not scheduled.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarSecondaryViewsTargetFPS(
+		TEXT("r.AsyncReprojection.SecondaryViews.TargetFPS"),
+		0.0f,
+		TEXT("SecondaryViews: capture rate of each scene capture. 0 = capture on the frames that render the world.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarSecondaryViewsMaxCapturesPerFrame(
+		TEXT("r.AsyncReprojection.SecondaryViews.MaxCapturesPerFrame"),
+		0,
+		TEXT("SecondaryViews: most scene captures rendered in one frame; the longest-waiting go first. 0 = unlimited.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarFrameCacheReducedColorFormat(
+		TEXT("r.AsyncReprojection.FrameCache.ReducedColorFormat"),
+		0,
+		TEXT("Frame cache: store cached scene color as R11G11B10 float instead of the scene color format (drops alpha, halves bandwidth for FP16 scene color).\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarFrameCacheAsyncCompute(
+		TEXT("r.AsyncReprojection.FrameCache.AsyncCompute"),
+		0,
+		TEXT("Frame cache: run the capture dispatch on the async compute queue so it overlaps the rest of post processing.\n")
+		TEXT("Ignored on RHIs without efficient async compute.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarFrameCacheBudgetMB(
+		TEXT("r.AsyncReprojection.FrameCache.BudgetMB"),
+		0,
+		TEXT("Frame cache: VRAM budget (MB) across all players. 0 = unlimited.\n")
+		TEXT("Over budget the cache first reduces color/depth formats, then drops the present fallback, then refuses to capture.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarFrameCacheIdleReleaseSeconds(
+		TEXT("r.AsyncReprojection.FrameCache.IdleReleaseSeconds"),
+		10.0f,
+		TEXT("Frame cache: release a player's cached targets after this many seconds without a capture or present. 0 = never.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarFrameCacheCaptureAtDisplayResolution(
+		TEXT("r.AsyncReprojection.FrameCache.CaptureAtDisplayResolution"),
+		0,
+		TEXT("Frame cache: capture point.\n")
+		TEXT("0 = internal resolution, before upscaling (TSR/TAAU output is not cached; the present warp resamples the render-resolution frame).\n")
+		TEXT("1 = display resolution, after upscaling and post processing; depth is point-sampled from the render-resolution depth buffer.\n")
+		TEXT("Requires r.AsyncReprojection.WarpPoint=1; the EndOfPostProcess warp would otherwise be captured.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarStereo(
+		TEXT("r.AsyncReprojection.Stereo"),
+		0,
+		TEXT("Stereo: cache and warp each eye of a stereo view family separately, driven by head poses from r.AsyncReprojection.Stereo.PoseSource.\n")
+		TEXT("Stereo eye views are ignored while disabled.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarStereoPoseSource(
+		TEXT("r.AsyncReprojection.Stereo.PoseSource"),
+		0,
+		TEXT("Stereo head pose source:\n")
+		TEXT("0 = XR tracking system (HMD pose)\n")
+		TEXT("1 = simulated head motion (for validation with emulated stereo and no HMD)\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarStereoSimulatedAmplitude(
+		TEXT("r.AsyncReprojection.Stereo.SimulatedAmplitude"),
+		2.0f,
+		TEXT("Simulated pose source: peak yaw/pitch (degrees) of the head motion.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarStereoSimulatedFrequencyHz(
+		TEXT("r.AsyncReprojection.Stereo.SimulatedFrequencyHz"),
+		0.5f,
+		TEXT("Simulated pose source: oscillation frequency (Hz) of the head motion.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarPoseProvider(
+		TEXT("r.AsyncReprojection.PoseProvider"),
+		0,
+		TEXT("Latest camera pose that non-stereo warps reproject to, queried when each warp is recorded:\n")
+		TEXT("0 = PlayerCameraManager snapshot from the end of the game frame\n")
+		TEXT("1 = snapshot turned by the mouse input since it was taken (replaces InputDrivenPose)\n")
+		TEXT("2 = snapshot extrapolated with the camera velocity, up to PoseProvider.MaxPredictionMs\n")
+		TEXT("Ignored while a custom provider is set with SetAsyncReprojectionPoseProviderOverride.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarPoseProviderMaxPredictionMs(
+		TEXT("r.AsyncReprojection.PoseProvider.MaxPredictionMs"),
+		20.0f,
+		TEXT("Furthest (ms) a pose provider extrapolates past its newest camera sample.\n"),
+		ECVF_RenderThreadSafe);
+
 	static TAutoConsoleVariable<int32> CVarInputDrivenPose(
 		TEXT("r.AsyncReprojection.InputDrivenPose"),
 		1,
@@ -132,6 +341,59 @@ namespace AsyncReprojectionCVars
 		TEXT("InputDrivenPose: pitch degrees per mouse pixel (positive = move mouse up pitches up).\n"),
 		ECVF_RenderThreadSafe);
 
+	static TAutoConsoleVariable<int32> CVarInputAutoCalibrate(
+		TEXT("r.AsyncReprojection.InputAutoCalibrate"),
+		1,
+		TEXT("If enabled, fits the yaw and pitch degrees per mouse pixel from the PlayerCameraManager rotation that follows mouse movement,\n")
+		TEXT("and uses each fitted gain in place of InputYawDegreesPerPixel / InputPitchDegreesPerPixel once it is confident.\n")
+		TEXT("Setting it to 0 discards the fit.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarInputAutoCalibrateMinSamples(
+		TEXT("r.AsyncReprojection.InputAutoCalibrate.MinSamples"),
+		30,
+		TEXT("InputAutoCalibrate: frames with mouse movement on an axis before its gain can be used.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarInputAutoCalibrateMinConfidence(
+		TEXT("r.AsyncReprojection.InputAutoCalibrate.MinConfidence"),
+		0.9f,
+		TEXT("InputAutoCalibrate: fraction of the camera rotation [0, 1] the fitted gain must explain before it is used.\n")
+		TEXT("Games with mouse smoothing or acceleration may need a lower value.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarInputAutoCalibrateWindowSamples(
+		TEXT("r.AsyncReprojection.InputAutoCalibrate.WindowSamples"),
+		240,
+		TEXT("InputAutoCalibrate: approximate number of recent samples the fit remembers, so it follows sensitivity changes.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarInputStickYawDegreesPerSecond(
+		TEXT("r.AsyncReprojection.InputStick.YawDegreesPerSecond"),
+		0.0f,
+		TEXT("InputDrivenPose: yaw degrees per second at full right-stick deflection (positive = stick right turns right).\n")
+		TEXT("0 ignores the horizontal stick axis. Match the game's look rate so the warp agrees with the next frame.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarInputStickPitchDegreesPerSecond(
+		TEXT("r.AsyncReprojection.InputStick.PitchDegreesPerSecond"),
+		0.0f,
+		TEXT("InputDrivenPose: pitch degrees per second at full right-stick deflection (positive = stick up pitches up; negative for inverted look).\n")
+		TEXT("0 ignores the vertical stick axis.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarInputStickDeadZone(
+		TEXT("r.AsyncReprojection.InputStick.DeadZone"),
+		0.15f,
+		TEXT("InputDrivenPose: radial right-stick dead zone in [0, 1). Deflection beyond it is rescaled to [0, 1].\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<float> CVarInputStickExponent(
+		TEXT("r.AsyncReprojection.InputStick.Exponent"),
+		1.0f,
+		TEXT("InputDrivenPose: response exponent applied to the rescaled right-stick deflection (1 = linear).\n"),
+		ECVF_RenderThreadSafe);
+
 	static TAutoConsoleVariable<float> CVarMaxYawDeg(
 		TEXT("r.AsyncReprojection.MaxYawDegreesPerFrame"),
 		2.0f,
@@ -186,6 +448,13 @@ namespace AsyncReprojectionCVars
 		TEXT("Auto mode: maximum translation magnitude (cm).\n"),
 		ECVF_RenderThreadSafe);
 
+	static TAutoConsoleVariable<float> CVarAutoMaxWarpFallbackRatio(
+		TEXT("r.AsyncReprojection.AutoMaxWarpFallbackRatio"),
+		0.3f,
+		TEXT("Auto mode: maximum fraction of cached-warp pixels that fell back to rotation-only or left the cached frame, as measured by r.AsyncReprojection.WarpMetrics.\n")
+		TEXT("0 = ignore the warp metrics.\n"),
+		ECVF_RenderThreadSafe);
+
 	static TAutoConsoleVariable<int32> CVarDebugOverlay(
 		TEXT("r.AsyncReprojection.DebugOverlay"),
 		0,
@@ -198,6 +467,36 @@ namespace AsyncReprojectionCVars
 		TEXT("Freeze warp parameters for A/B testing.\n"),
 		ECVF_RenderThreadSafe);
 
+	static TAutoConsoleVariable<int32> CVarWarpMetrics(
+		TEXT("r.AsyncReprojection.WarpMetrics"),
+		0,
+		TEXT("Count rotation-only fallbacks, out-of-bounds samples and occlusion-fallback hits in the cached warp shaders.\n")
+		TEXT("Counters are read back without stalling and reported through stat AsyncReprojection and the AsyncReprojection CSV category.\n")
+		TEXT("Compiled with the debug permutations only (r.AsyncReprojection.CompileDebugPermutations); ignored in Shipping.\n"),
+		ECVF_RenderThreadSafe);
+
+	static TAutoConsoleVariable<int32> CVarCompileDebugPermutations(
+		TEXT("r.AsyncReprojection.CompileDebugPermutations"),
+		1,
+		TEXT("Compile the debug overlay and warp metrics permutations of the cached warp shaders for targets without editor data, read per shader\n")
+		TEXT("platform from the config the cook uses. Set to 0 in the config that cooks Shipping builds to cut the cached warp\n")
+		TEXT("permutation count to a third; DebugOverlay is then ignored by the present passes. Editor targets always compile them.\n"),
+		ECVF_ReadOnly);
+
+	static TAutoConsoleVariable<int32> CVarCompileObjectMotionPermutations(
+		TEXT("r.AsyncReprojection.CompileObjectMotionPermutations"),
+		1,
+		TEXT("Compile the object motion permutations of the cached warp shaders, read per shader platform from the config the cook uses,\n")
+		TEXT("for editor targets too. Set to 0 in projects that never use AsyncPresent.ObjectMotion, which is then ignored.\n"),
+		ECVF_ReadOnly);
+
+	static TAutoConsoleVariable<int32> CVarCompileFarFieldPermutations(
+		TEXT("r.AsyncReprojection.CompileFarFieldPermutations"),
+		1,
+		TEXT("Compile the far-field permutations of the cached warp shaders, read per shader platform from the config the cook uses,\n")
+		TEXT("for editor targets too. Set to 0 in projects that never use FarField, which is then ignored.\n"),
+		ECVF_ReadOnly);
+
 	static TAutoConsoleVariable<float> CVarRefreshHzOverride(
 		TEXT("r.AsyncReprojection.RefreshHzOverride"),
 		0.0f,
@@ -314,10 +613,67 @@ FAsyncReprojectionCVarState FAsyncReprojectionCVars::Get()
 	Out.bAsyncPresentReprojectMovement = AsyncReprojectionCVars::CVarAsyncPresentReprojectMovement.GetValueOnAnyThread() != 0;
 	Out.bAsyncPresentStretchBorders = AsyncReprojectionCVars::CVarAsyncPresentStretchBorders.GetValueOnAnyThread() != 0;
 	Out.bAsyncPresentOcclusionFallback = AsyncReprojectionCVars::CVarAsyncPresentOcclusionFallback.GetValueOnAnyThread() != 0;
-
-	Out.bInputDrivenPose = AsyncReprojectionCVars::CVarInputDrivenPose.GetValueOnAnyThread() != 0;
+	Out.bAsyncPresentObjectMotion = AsyncReprojectionCVars::CVarAsyncPresentObjectMotion.GetValueOnAnyThread() != 0
+		&& FAsyncReprojectionCVars::CanUseObjectMotionPermutations();
+	Out.AsyncPresentObjectMotionMaxMs = AsyncReprojectionCVars::CVarAsyncPresentObjectMotionMaxMs.GetValueOnAnyThread();
+	Out.bAsyncPresentGPUWarpParams = AsyncReprojectionCVars::CVarAsyncPresentGPUWarpParams.GetValueOnAnyThread() != 0;
+	Out.bCompositor = AsyncReprojectionCVars::CVarCompositor.GetValueOnAnyThread() != 0;
+	Out.CompositorStallRefreshIntervals = AsyncReprojectionCVars::CVarCompositorStallRefreshIntervals.GetValueOnAnyThread();
+	Out.bHitchMask = AsyncReprojectionCVars::CVarHitchMask.GetValueOnAnyThread() != 0;
+	Out.HitchMaskFrameTimeMultiplier = AsyncReprojectionCVars::CVarHitchMaskFrameTimeMultiplier.GetValueOnAnyThread();
+	Out.HitchMaskMinMs = AsyncReprojectionCVars::CVarHitchMaskMinMs.GetValueOnAnyThread();
+	Out.HitchMaskMaxSeconds = AsyncReprojectionCVars::CVarHitchMaskMaxSeconds.GetValueOnAnyThread();
+	Out.bOverscan = AsyncReprojectionCVars::CVarOverscan.GetValueOnAnyThread() != 0;
+	Out.OverscanMinDegrees = AsyncReprojectionCVars::CVarOverscanMinDegrees.GetValueOnAnyThread();
+	Out.OverscanMaxDegrees = AsyncReprojectionCVars::CVarOverscanMaxDegrees.GetValueOnAnyThread();
+	Out.OverscanLookaheadMs = AsyncReprojectionCVars::CVarOverscanLookaheadMs.GetValueOnAnyThread();
+	Out.bFarField = AsyncReprojectionCVars::CVarFarField.GetValueOnAnyThread() != 0
+		&& FAsyncReprojectionCVars::CanUseFarFieldPermutations();
+	Out.FarFieldResolution = AsyncReprojectionCVars::CVarFarFieldResolution.GetValueOnAnyThread();
+	Out.FarFieldMinDistanceCm = AsyncReprojectionCVars::CVarFarFieldMinDistanceCm.GetValueOnAnyThread();
+	Out.bForeground = AsyncReprojectionCVars::CVarForeground.GetValueOnAnyThread() != 0;
+	Out.bSecondaryViews = AsyncReprojectionCVars::CVarSecondaryViews.GetValueOnAnyThread() != 0;
+	Out.SecondaryViewsTargetFPS = AsyncReprojectionCVars::CVarSecondaryViewsTargetFPS.GetValueOnAnyThread();
+	Out.SecondaryViewsMaxCapturesPerFrame = AsyncReprojectionCVars::CVarSecondaryViewsMaxCapturesPerFrame.GetValueOnAnyThread();
+
+	Out.bFrameCacheReducedColorFormat = AsyncReprojectionCVars::CVarFrameCacheReducedColorFormat.GetValueOnAnyThread() != 0;
+	Out.bFrameCacheAsyncCompute = AsyncReprojectionCVars::CVarFrameCacheAsyncCompute.GetValueOnAnyThread() != 0;
+	Out.FrameCacheBudgetMB = AsyncReprojectionCVars::CVarFrameCacheBudgetMB.GetValueOnAnyThread();
+	Out.FrameCacheIdleReleaseSeconds = AsyncReprojectionCVars::CVarFrameCacheIdleReleaseSeconds.GetValueOnAnyThread();
+	Out.bFrameCacheCaptureAtDisplayResolution = AsyncReprojectionCVars::CVarFrameCacheCaptureAtDisplayResolution.GetValueOnAnyThread() != 0;
+	Out.bStereo = AsyncReprojectionCVars::CVarStereo.GetValueOnAnyThread() != 0;
+	Out.StereoPoseSource = AsyncReprojectionCVars::CVarStereoPoseSource.GetValueOnAnyThread();
+	Out.StereoSimulatedAmplitudeDegrees = AsyncReprojectionCVars::CVarStereoSimulatedAmplitude.GetValueOnAnyThread();
+	Out.StereoSimulatedFrequencyHz = AsyncReprojectionCVars::CVarStereoSimulatedFrequencyHz.GetValueOnAnyThread();
+
+	Out.PoseProvider = AsyncReprojectionCVars::CVarPoseProvider.GetValueOnAnyThread();
+	Out.PoseProviderMaxPredictionMs = AsyncReprojectionCVars::CVarPoseProviderMaxPredictionMs.GetValueOnAnyThread();
+
+	// The SnapshotInput provider already applies the input since the snapshot; InputDrivenPose would apply it twice.
+	Out.bInputDrivenPose = AsyncReprojectionCVars::CVarInputDrivenPose.GetValueOnAnyThread() != 0 && Out.PoseProvider != 1;
 	Out.InputYawDegreesPerPixel = AsyncReprojectionCVars::CVarInputYawDegreesPerPixel.GetValueOnAnyThread();
 	Out.InputPitchDegreesPerPixel = AsyncReprojectionCVars::CVarInputPitchDegreesPerPixel.GetValueOnAnyThread();
+	Out.bInputAutoCalibrate = AsyncReprojectionCVars::CVarInputAutoCalibrate.GetValueOnAnyThread() != 0;
+	Out.InputAutoCalibrateMinSamples = AsyncReprojectionCVars::CVarInputAutoCalibrateMinSamples.GetValueOnAnyThread();
+	Out.InputAutoCalibrateMinConfidence = AsyncReprojectionCVars::CVarInputAutoCalibrateMinConfidence.GetValueOnAnyThread();
+	Out.InputAutoCalibrateWindowSamples = AsyncReprojectionCVars::CVarInputAutoCalibrateWindowSamples.GetValueOnAnyThread();
+	if (Out.bInputAutoCalibrate)
+	{
+		// An axis without a confident fit yet keeps its CVar value.
+		const FVector2f CalibratedDegreesPerPixel = FAsyncReprojectionInputCalibration::Get().GetDegreesPerPixel_AnyThread();
+		if (CalibratedDegreesPerPixel.X != 0.0f)
+		{
+			Out.InputYawDegreesPerPixel = CalibratedDegreesPerPixel.X;
+		}
+		if (CalibratedDegreesPerPixel.Y != 0.0f)
+		{
+			Out.InputPitchDegreesPerPixel = CalibratedDegreesPerPixel.Y;
+		}
+	}
+	Out.InputStickYawDegreesPerSecond = AsyncReprojectionCVars::CVarInputStickYawDegreesPerSecond.GetValueOnAnyThread();
+	Out.InputStickPitchDegreesPerSecond = AsyncReprojectionCVars::CVarInputStickPitchDegreesPerSecond.GetValueOnAnyThread();
+	Out.InputStickDeadZone = AsyncReprojectionCVars::CVarInputStickDeadZone.GetValueOnAnyThread();
+	Out.InputStickExponent = AsyncReprojectionCVars::CVarInputStickExponent.GetValueOnAnyThread();
 
 	Out.MaxYawDegreesPerFrame = AsyncReprojectionCVars::CVarMaxYawDeg.GetValueOnAnyThread();
 	Out.MaxPitchDegreesPerFrame = AsyncReprojectionCVars::CVarMaxPitchDeg.GetValueOnAnyThread();
@@ -329,12 +685,34 @@ FAsyncReprojectionCVarState FAsyncReprojectionCVars::Get()
 	Out.AutoMaxFPSStdDev = AsyncReprojectionCVars::CVarAutoMaxFPSStdDev.GetValueOnAnyThread();
 	Out.AutoMaxWarpDegrees = AsyncReprojectionCVars::CVarAutoMaxWarpDegrees.GetValueOnAnyThread();
 	Out.AutoMaxTranslationCm = AsyncReprojectionCVars::CVarAutoMaxTranslationCm.GetValueOnAnyThread();
+	Out.AutoMaxWarpFallbackRatio = AsyncReprojectionCVars::CVarAutoMaxWarpFallbackRatio.GetValueOnAnyThread();
 
 	Out.bDebugOverlay = AsyncReprojectionCVars::CVarDebugOverlay.GetValueOnAnyThread() != 0;
 	Out.bDebugFreezeWarp = AsyncReprojectionCVars::CVarDebugFreezeWarp.GetValueOnAnyThread() != 0;
+	// The counting permutations are only cooked alongside the debug ones.
+	Out.bWarpMetrics = AsyncReprojectionCVars::CVarWarpMetrics.GetValueOnAnyThread() != 0 && FAsyncReprojectionCVars::CanUseDebugPermutations();
 
 	Out.RefreshHzOverride = AsyncReprojectionCVars::CVarRefreshHzOverride.GetValueOnAnyThread();
 	Out.bEnableInEditor = AsyncReprojectionCVars::CVarEnableInEditor.GetValueOnAnyThread() != 0;
 
 	return Out;
 }
+
+bool FAsyncReprojectionCVars::CanUseDebugPermutations()
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	return AsyncReprojectionCVars::CVarCompileDebugPermutations.GetValueOnAnyThread() != 0;
+#endif
+}
+
+bool FAsyncReprojectionCVars::CanUseObjectMotionPermutations()
+{
+	return AsyncReprojectionCVars::CVarCompileObjectMotionPermutations.GetValueOnAnyThread() != 0;
+}
+
+bool FAsyncReprojectionCVars::CanUseFarFieldPermutations()
+{
+	return AsyncReprojectionCVars::CVarCompileFarFieldPermutations.GetValueOnAnyThread() != 0;
+}
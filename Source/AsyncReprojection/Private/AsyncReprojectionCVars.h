@@ -19,15 +19,58 @@ struct FAsyncReprojectionCVarState
 	bool bAsyncPresentReprojectMovement = true;
 	bool bAsyncPresentStretchBorders = false;
 	bool bAsyncPresentOcclusionFallback = true;
+	bool bAsyncPresentObjectMotion = true;
+	int32 AsyncPresentObjectMotionMaxMs = 100;
+	bool bAsyncPresentGPUWarpParams = false;
+	bool bCompositor = false;
+	float CompositorStallRefreshIntervals = 1.5f;
+	bool bHitchMask = false;
+	float HitchMaskFrameTimeMultiplier = 3.0f;
+	float HitchMaskMinMs = 50.0f;
+	float HitchMaskMaxSeconds = 5.0f;
+	bool bOverscan = false;
+	float OverscanMinDegrees = 0.0f;
+	float OverscanMaxDegrees = 5.0f;
+	float OverscanLookaheadMs = 100.0f;
+	bool bFarField = false;
+	int32 FarFieldResolution = 256;
+	float FarFieldMinDistanceCm = 20000.0f;
+	bool bForeground = false;
+	bool bSecondaryViews = false;
+	float SecondaryViewsTargetFPS = 0.0f;
+	int32 SecondaryViewsMaxCapturesPerFrame = 0;
+
+	bool bFrameCacheReducedColorFormat = false;
+	bool bFrameCacheAsyncCompute = false;
+	int32 FrameCacheBudgetMB = 0;
+	float FrameCacheIdleReleaseSeconds = 10.0f;
+	bool bFrameCacheCaptureAtDisplayResolution = false;
+
+	bool bStereo = false;
+	int32 StereoPoseSource = 0;
+	float StereoSimulatedAmplitudeDegrees = 2.0f;
+	float StereoSimulatedFrequencyHz = 0.5f;
 
 	bool bEnableRotationWarp = true;
 	bool bEnableTranslationWarp = true;
 	bool bRequireDepthForTranslation = true;
 	bool bWarpAfterUI = false;
 
+	/** 0 = snapshot, 1 = snapshot + input, 2 = predicted (see IAsyncReprojectionPoseProvider). */
+	int32 PoseProvider = 0;
+	float PoseProviderMaxPredictionMs = 20.0f;
+
 	bool bInputDrivenPose = false;
 	float InputYawDegreesPerPixel = 0.0f;
 	float InputPitchDegreesPerPixel = 0.0f;
+	bool bInputAutoCalibrate = false;
+	int32 InputAutoCalibrateMinSamples = 30;
+	float InputAutoCalibrateMinConfidence = 0.9f;
+	int32 InputAutoCalibrateWindowSamples = 240;
+	float InputStickYawDegreesPerSecond = 0.0f;
+	float InputStickPitchDegreesPerSecond = 0.0f;
+	float InputStickDeadZone = 0.15f;
+	float InputStickExponent = 1.0f;
 
 	float MaxYawDegreesPerFrame = 2.0f;
 	float MaxPitchDegreesPerFrame = 2.0f;
@@ -39,9 +82,11 @@ struct FAsyncReprojectionCVarState
 	float AutoMaxFPSStdDev = 1.5f;
 	float AutoMaxWarpDegrees = 1.5f;
 	float AutoMaxTranslationCm = 3.0f;
+	float AutoMaxWarpFallbackRatio = 0.3f;
 
 	bool bDebugOverlay = false;
 	bool bDebugFreezeWarp = false;
+	bool bWarpMetrics = false;
 
 	float RefreshHzOverride = 0.0f;
 	bool bEnableInEditor = false;
@@ -52,4 +97,14 @@ class FAsyncReprojectionCVars
 public:
 	static void Init();
 	static FAsyncReprojectionCVarState Get();
+
+	/**
+	 * Whether this binary selects debug-only shader permutations (debug overlay, warp metrics): false in Shipping, otherwise the read-only
+	 * r.AsyncReprojection.CompileDebugPermutations the cook of those permutations was decided by.
+	 */
+	static bool CanUseDebugPermutations();
+
+	/** Whether object motion and far-field permutations were compiled: the read-only r.AsyncReprojection.Compile*Permutations. */
+	static bool CanUseObjectMotionPermutations();
+	static bool CanUseFarFieldPermutations();
 };
@@ -2,7 +2,12 @@
 
 #include "AsyncReprojectionCameraTracker.h"
 
+#include "AsyncReprojection.h"
 #include "AsyncReprojectionCVars.h"
+#include "AsyncReprojectionCompositor.h"
+#include "AsyncReprojectionFrameCache.h"
+#include "AsyncReprojectionInputCalibration.h"
+#include "AsyncReprojectionStereo.h"
 
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
@@ -11,6 +16,110 @@
 #include "GameFramework/PlayerController.h"
 #include "HAL/IConsoleManager.h"
 #include "Misc/CoreDelegates.h"
+#include "RenderingThread.h"
+
+namespace AsyncReprojectionCameraTrackerPrivate
+{
+	static constexpr uint64 VerboseLogFrameInterval = 120;
+	static uint64 LastMissingPoseWarnFrame = 0;
+
+	/** Snapshots further apart than this (a hitch or a paused game) leave the previous camera velocity in place. */
+	static constexpr double MaxVelocitySampleSeconds = 0.25;
+	static constexpr double MinVelocitySampleSeconds = 0.0005;
+
+	/**
+	 * @class FSnapshotPoseProvider
+	 *
+	 * The camera the PlayerCameraManager (or SubmitAsyncReprojectionLatestCameraTransform) reported at the end of the
+	 * last game frame.
+	 */
+	class FSnapshotPoseProvider final : public IAsyncReprojectionPoseProvider
+	{
+	public:
+		virtual const TCHAR* GetName() const override
+		{
+			return TEXT("Snapshot");
+		}
+
+		virtual bool GetLatestPose_RenderThread(const FAsyncReprojectionPoseQuery& Query, FAsyncReprojectionPose& OutPose) const override
+		{
+			OutPose = Query.Snapshot;
+			return OutPose.bIsValid;
+		}
+	};
+
+	/**
+	 * @class FSnapshotInputPoseProvider
+	 *
+	 * The snapshot turned by the mouse and look-stick input since it was published, like a first-person camera that
+	 * applies look input directly to its rotation.
+	 */
+	class FSnapshotInputPoseProvider final : public IAsyncReprojectionPoseProvider
+	{
+	public:
+		virtual const TCHAR* GetName() const override
+		{
+			return TEXT("SnapshotInput");
+		}
+
+		virtual bool GetLatestPose_RenderThread(const FAsyncReprojectionPoseQuery& Query, FAsyncReprojectionPose& OutPose) const override
+		{
+			if (!Query.Snapshot.bIsValid)
+			{
+				return false;
+			}
+
+			const FQuat SnapshotRotation = Query.Snapshot.CameraTransform.GetRotation();
+			const float YawDeg = Query.InputMouseDelta.X * Query.InputDegreesPerPixel.X + Query.InputStickDegrees.X;
+			const float PitchDeg = (-Query.InputMouseDelta.Y) * Query.InputDegreesPerPixel.Y + Query.InputStickDegrees.Y;
+
+			const FQuat YawQuat(FVector::UpVector, FMath::DegreesToRadians(YawDeg));
+			const FVector PitchAxis = SnapshotRotation.RotateVector(FVector::RightVector);
+			const FQuat PitchQuat(PitchAxis, FMath::DegreesToRadians(PitchDeg));
+
+			OutPose.bIsValid = true;
+			OutPose.CameraTransform = FTransform(PitchQuat * YawQuat * SnapshotRotation, Query.Snapshot.CameraTransform.GetLocation());
+			OutPose.TimeSeconds = Query.TimeSeconds;
+			return true;
+		}
+	};
+
+	/**
+	 * @class FPredictedPoseProvider
+	 *
+	 * The snapshot extrapolated to the query time with the camera velocity between the last two snapshots, up to
+	 * MaxPredictionSeconds.
+	 */
+	class FPredictedPoseProvider final : public IAsyncReprojectionPoseProvider
+	{
+	public:
+		virtual const TCHAR* GetName() const override
+		{
+			return TEXT("Predicted");
+		}
+
+		virtual bool GetLatestPose_RenderThread(const FAsyncReprojectionPoseQuery& Query, FAsyncReprojectionPose& OutPose) const override
+		{
+			if (!Query.Snapshot.bIsValid)
+			{
+				return false;
+			}
+
+			const double PredictSeconds = FMath::Clamp(Query.TimeSeconds - Query.Snapshot.TimeSeconds, 0.0, Query.MaxPredictionSeconds);
+			const double AngularSpeed = Query.SnapshotAngularVelocity.Size();
+			const FQuat PredictedTurn = AngularSpeed > UE_SMALL_NUMBER
+				? FQuat(Query.SnapshotAngularVelocity / AngularSpeed, AngularSpeed * PredictSeconds)
+				: FQuat::Identity;
+
+			OutPose.bIsValid = true;
+			OutPose.CameraTransform = FTransform(
+				PredictedTurn * Query.Snapshot.CameraTransform.GetRotation(),
+				Query.Snapshot.CameraTransform.GetLocation() + Query.SnapshotLinearVelocity * PredictSeconds);
+			OutPose.TimeSeconds = Query.Snapshot.TimeSeconds + PredictSeconds;
+			return true;
+		}
+	};
+}
 
 namespace AsyncReprojectionAtomic
 {
@@ -50,13 +159,10 @@ FAsyncReprojectionCameraTracker& FAsyncReprojectionCameraTracker::Get()
 }
 
 FAsyncReprojectionCameraTracker::FAsyncReprojectionCameraTracker()
+	: SnapshotPoseProvider(MakeUnique<AsyncReprojectionCameraTrackerPrivate::FSnapshotPoseProvider>())
+	, SnapshotInputPoseProvider(MakeUnique<AsyncReprojectionCameraTrackerPrivate::FSnapshotInputPoseProvider>())
+	, PredictedPoseProvider(MakeUnique<AsyncReprojectionCameraTrackerPrivate::FPredictedPoseProvider>())
 {
-	for (int32 Index = 0; Index < MaxTrackedPlayers; Index++)
-	{
-		ExternalCameraSubmitFrameCounter[Index].Store(0, EMemoryOrder::Relaxed);
-		MouseXTotal[Index].store(0.0f, std::memory_order_relaxed);
-		MouseYTotal[Index].store(0.0f, std::memory_order_relaxed);
-	}
 }
 
 FAsyncReprojectionCameraTracker::~FAsyncReprojectionCameraTracker()
@@ -94,93 +200,311 @@ void FAsyncReprojectionCameraTracker::Shutdown()
 	TrackedFPSStdDev.Store(0.0f);
 	TrackedRefreshHz.Store(0.0f);
 
-	for (int32 Index = 0; Index < MaxTrackedPlayers; Index++)
+	for (int32 Index = 0; Index < Players.Num(); Index++)
 	{
-		ExternalCameraSubmitFrameCounter[Index].Store(0, EMemoryOrder::Relaxed);
-		MouseXTotal[Index].store(0.0f, std::memory_order_relaxed);
-		MouseYTotal[Index].store(0.0f, std::memory_order_relaxed);
+		FPlayerState* Player = Players.Find(Index);
+		Player->ExternalCameraSubmitFrameCounter.Store(0, EMemoryOrder::Relaxed);
+		Player->MouseXTotal.store(0.0f, std::memory_order_relaxed);
+		Player->MouseYTotal.store(0.0f, std::memory_order_relaxed);
+		Player->LookStick.Reset();
+		Player->LookStickDeflection = FVector2f::ZeroVector;
 	}
 }
 
 FAsyncReprojectionCameraSnapshot FAsyncReprojectionCameraTracker::GetLatestCamera(int32 PlayerIndex) const
 {
-	if (PlayerIndex < 0 || PlayerIndex >= MaxTrackedPlayers)
+	const FPlayerState* Player = Players.Find(PlayerIndex);
+	if (Player == nullptr)
 	{
 		return FAsyncReprojectionCameraSnapshot();
 	}
 
-	const FCameraBuffer& Buffer = CameraBuffers[PlayerIndex];
-	const uint32 Index = Buffer.WriteIndex.Load(EMemoryOrder::Relaxed) & 1u;
-	return Buffer.Snapshots[Index];
+	return Player->Camera.Read();
+}
+
+bool FAsyncReprojectionCameraTracker::QueryLatestCamera(int32 PlayerIndex, const FAsyncReprojectionCVarState& CVarState, const IAsyncReprojectionPoseProvider& PoseProvider, FAsyncReprojectionCameraSnapshot& OutCamera) const
+{
+	const FPlayerState* Player = Players.Find(PlayerIndex);
+	if (Player == nullptr)
+	{
+		OutCamera = FAsyncReprojectionCameraSnapshot();
+		return false;
+	}
+
+	OutCamera = Player->Camera.Read();
+
+	FAsyncReprojectionPoseQuery Query;
+	Query.PlayerIndex = PlayerIndex;
+	Query.TimeSeconds = FPlatformTime::Seconds();
+	Query.Snapshot.bIsValid = OutCamera.bIsValid;
+	Query.Snapshot.CameraTransform = OutCamera.CameraTransform;
+	Query.Snapshot.TimeSeconds = OutCamera.TimeSeconds;
+	Query.SnapshotAngularVelocity = OutCamera.AngularVelocity;
+	Query.SnapshotLinearVelocity = OutCamera.LinearVelocity;
+	const FAsyncReprojectionInputTotals InputTotals = GetInputTotals(*Player, Query.TimeSeconds);
+	Query.InputMouseDelta = InputTotals.MousePixels - OutCamera.InputTotals.MousePixels;
+	Query.InputStickDegrees = InputTotals.StickDegrees - OutCamera.InputTotals.StickDegrees;
+	Query.InputDegreesPerPixel = FVector2f(CVarState.InputYawDegreesPerPixel, CVarState.InputPitchDegreesPerPixel);
+	Query.MaxPredictionSeconds = double(FMath::Max(0.0f, CVarState.PoseProviderMaxPredictionMs)) / 1000.0;
+
+	FAsyncReprojectionPose Pose;
+	if (!PoseProvider.GetLatestPose_RenderThread(Query, Pose) || !Pose.bIsValid)
+	{
+		return false;
+	}
+
+	OutCamera.bIsValid = true;
+	OutCamera.CameraTransform = Pose.CameraTransform;
+	OutCamera.TimeSeconds = Pose.TimeSeconds;
+	return true;
+}
+
+FAsyncReprojectionCameraSnapshot FAsyncReprojectionCameraTracker::GetLatestCamera_RenderThread(int32 PlayerIndex, const FAsyncReprojectionCVarState& CVarState) const
+{
+	using namespace AsyncReprojectionCameraTrackerPrivate;
+
+	const IAsyncReprojectionPoseProvider& PoseProvider = SelectPoseProvider_RenderThread(CVarState);
+	FAsyncReprojectionCameraSnapshot Latest;
+	if (!QueryLatestCamera(PlayerIndex, CVarState, PoseProvider, Latest)
+		&& Players.Find(PlayerIndex) != nullptr
+		&& &PoseProvider != SnapshotPoseProvider.Get()
+		&& (GFrameCounterRenderThread - LastMissingPoseWarnFrame) >= VerboseLogFrameInterval)
+	{
+		UE_LOG(LogAsyncReprojection, Warning, TEXT("Pose provider %s has no pose for PlayerIndex=%d; using the camera snapshot."), PoseProvider.GetName(), PlayerIndex);
+		LastMissingPoseWarnFrame = GFrameCounterRenderThread;
+	}
+	return Latest;
+}
+
+FAsyncReprojectionCameraTracker::FPinnedPoseProvider FAsyncReprojectionCameraTracker::PinPoseProvider_RenderThread(const FAsyncReprojectionCVarState& CVarState) const
+{
+	FPinnedPoseProvider Pinned;
+	Pinned.Provider = &SelectPoseProvider_RenderThread(CVarState);
+	Pinned.Override = OverridePoseProvider;
+	return Pinned;
+}
+
+FAsyncReprojectionCameraSnapshot FAsyncReprojectionCameraTracker::GetLatestCamera_AnyThread(int32 PlayerIndex, const FAsyncReprojectionCVarState& CVarState, const FPinnedPoseProvider& PoseProvider) const
+{
+	check(PoseProvider.Provider != nullptr);
+
+	FAsyncReprojectionCameraSnapshot Latest;
+	QueryLatestCamera(PlayerIndex, CVarState, *PoseProvider.Provider, Latest);
+	return Latest;
+}
+
+void FAsyncReprojectionCameraTracker::SetPoseProviderOverride_GameThread(TSharedPtr<IAsyncReprojectionPoseProvider, ESPMode::ThreadSafe> PoseProvider)
+{
+	check(IsInGameThread());
+
+	UE_LOG(LogAsyncReprojection, Log, TEXT("Pose provider override %s."), PoseProvider.IsValid() ? PoseProvider->GetName() : TEXT("cleared"));
+	GameThreadOverridePoseProvider = PoseProvider;
+	ENQUEUE_RENDER_COMMAND(AsyncReprojectionPoseProviderOverride)(
+		[this, PoseProvider = MoveTemp(PoseProvider)](FRHICommandListImmediate& RHICmdList) mutable
+		{
+			OverridePoseProvider = MoveTemp(PoseProvider);
+		});
+}
+
+const IAsyncReprojectionPoseProvider& FAsyncReprojectionCameraTracker::SelectPoseProvider_RenderThread(const FAsyncReprojectionCVarState& CVarState) const
+{
+	if (OverridePoseProvider.IsValid())
+	{
+		return *OverridePoseProvider;
+	}
+
+	if (CVarState.PoseProvider == 1)
+	{
+		return *SnapshotInputPoseProvider;
+	}
+
+	if (CVarState.PoseProvider == 2)
+	{
+		return *PredictedPoseProvider;
+	}
+
+	return *SnapshotPoseProvider;
+}
+
+void SetAsyncReprojectionPoseProviderOverride(TSharedPtr<IAsyncReprojectionPoseProvider, ESPMode::ThreadSafe> PoseProvider)
+{
+	FAsyncReprojectionCameraTracker::Get().SetPoseProviderOverride_GameThread(MoveTemp(PoseProvider));
 }
 
 FAsyncReprojectionDeltaSnapshot FAsyncReprojectionCameraTracker::GetLatestDelta(int32 PlayerIndex) const
 {
-	if (PlayerIndex < 0 || PlayerIndex >= MaxTrackedPlayers)
+	const FPlayerState* Player = Players.Find(PlayerIndex);
+	if (Player == nullptr)
 	{
 		return FAsyncReprojectionDeltaSnapshot();
 	}
 
-	const FDeltaBuffer& Buffer = DeltaBuffers[PlayerIndex];
-	const uint32 Index = Buffer.WriteIndex.Load(EMemoryOrder::Relaxed) & 1u;
-	return Buffer.Snapshots[Index];
+	return Player->Delta.Read();
 }
 
 void FAsyncReprojectionCameraTracker::SubmitLatestCameraTransform_GameThread(int32 PlayerIndex, const FTransform& CameraTransform)
 {
 	check(IsInGameThread());
 
-	if (PlayerIndex < 0 || PlayerIndex >= MaxTrackedPlayers)
+	if (PlayerIndex < 0)
 	{
 		return;
 	}
 
-	FAsyncReprojectionCameraSnapshot Snapshot;
-	Snapshot.bIsValid = true;
-	Snapshot.TimeSeconds = FPlatformTime::Seconds();
-	Snapshot.CameraTransform = CameraTransform;
+	RegisterPlayers_GameThread(PlayerIndex + 1);
+	FPlayerState* Player = Players.Find(PlayerIndex);
+	if (Player == nullptr)
+	{
+		return;
+	}
 
-	FCameraBuffer& Buffer = CameraBuffers[PlayerIndex];
-	const uint32 NextIndex = (Buffer.WriteIndex.Load(EMemoryOrder::Relaxed) + 1u) & 1u;
-	Buffer.Snapshots[NextIndex] = Snapshot;
-	Buffer.WriteIndex.Store(NextIndex, EMemoryOrder::SequentiallyConsistent);
+	PublishCamera_GameThread(*Player, CameraTransform, FPlatformTime::Seconds());
 
-	ExternalCameraSubmitFrameCounter[PlayerIndex].Store(GFrameCounter, EMemoryOrder::Relaxed);
+	Player->ExternalCameraSubmitFrameCounter.Store(GFrameCounter, EMemoryOrder::Relaxed);
 }
 
 void FAsyncReprojectionCameraTracker::AddMouseDelta_GameThread(int32 PlayerIndex, float DeltaX, float DeltaY)
 {
-	if (PlayerIndex < 0 || PlayerIndex >= MaxTrackedPlayers)
+	// Slate user indices of devices without a local player must not grow the player tables.
+	if (PlayerIndex < 0 || PlayerIndex >= GetNumLocalPlayers_AnyThread())
+	{
+		return;
+	}
+
+	FPlayerState* Player = Players.Find(PlayerIndex);
+	if (Player == nullptr)
+	{
+		return;
+	}
+
+	AsyncReprojectionAtomic::FloatFetchAdd(Player->MouseXTotal, DeltaX);
+	AsyncReprojectionAtomic::FloatFetchAdd(Player->MouseYTotal, DeltaY);
+}
+
+void FAsyncReprojectionCameraTracker::SetLookStickAxis_GameThread(int32 PlayerIndex, EAxis::Type Axis, float Deflection)
+{
+	check(IsInGameThread());
+
+	if (PlayerIndex < 0 || PlayerIndex >= GetNumLocalPlayers_AnyThread() || (Axis != EAxis::X && Axis != EAxis::Y))
+	{
+		return;
+	}
+
+	FPlayerState* Player = Players.Find(PlayerIndex);
+	if (Player == nullptr)
+	{
+		return;
+	}
+
+	FVector2f NewDeflection = Player->LookStickDeflection;
+	if (Axis == EAxis::X)
+	{
+		NewDeflection.X = FMath::Clamp(Deflection, -1.0f, 1.0f);
+	}
+	else
+	{
+		NewDeflection.Y = FMath::Clamp(Deflection, -1.0f, 1.0f);
+	}
+
+	if (NewDeflection == Player->LookStickDeflection)
 	{
 		return;
 	}
+	Player->LookStickDeflection = NewDeflection;
 
-	AsyncReprojectionAtomic::FloatFetchAdd(MouseXTotal[PlayerIndex], DeltaX);
-	AsyncReprojectionAtomic::FloatFetchAdd(MouseYTotal[PlayerIndex], DeltaY);
+	// Close the integral at the old rate, then continue at the rate for the new deflection. Only the game thread
+	// publishes the stick, so the previous integral cannot change under this read.
+	const double NowSeconds = FPlatformTime::Seconds();
+	FStickIntegral Integral;
+	Integral.IntegratedDegrees = Player->LookStick.Read().GetDegreesAt(NowSeconds);
+	Integral.TurnRateDegreesPerSecond = EvaluateStickTurnRate_GameThread(PlayerIndex, NewDeflection);
+	Integral.EventTimeSeconds = NowSeconds;
+	Player->LookStick.Publish(Integral, GFrameCounter, NowSeconds);
 }
 
-FVector2f FAsyncReprojectionCameraTracker::GetMouseTotals_RenderThread(int32 PlayerIndex) const
+FVector2f FAsyncReprojectionCameraTracker::EvaluateStickTurnRate_GameThread(int32 PlayerIndex, const FVector2f& Deflection) const
 {
-	if (PlayerIndex < 0 || PlayerIndex >= MaxTrackedPlayers)
+	FVector2f TurnRate = FVector2f::ZeroVector;
+	if (GameThreadOverridePoseProvider.IsValid()
+		&& GameThreadOverridePoseProvider->GetStickTurnRate_GameThread(PlayerIndex, Deflection, TurnRate))
+	{
+		return TurnRate;
+	}
+
+	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
+	const float Magnitude = FMath::Min(Deflection.Size(), 1.0f);
+	const float DeadZone = FMath::Clamp(CVarState.InputStickDeadZone, 0.0f, 0.99f);
+	if (Magnitude <= DeadZone)
 	{
 		return FVector2f::ZeroVector;
 	}
 
+	// Radial dead zone rescaled to [0, 1], then the response exponent, applied along the stick direction.
+	const float Response = FMath::Pow((Magnitude - DeadZone) / (1.0f - DeadZone), FMath::Max(CVarState.InputStickExponent, 0.1f));
+	const FVector2f Direction = Deflection / Deflection.Size();
 	return FVector2f(
-		MouseXTotal[PlayerIndex].load(std::memory_order_relaxed),
-		MouseYTotal[PlayerIndex].load(std::memory_order_relaxed));
+		Direction.X * Response * CVarState.InputStickYawDegreesPerSecond,
+		Direction.Y * Response * CVarState.InputStickPitchDegreesPerSecond);
+}
+
+FAsyncReprojectionInputTotals FAsyncReprojectionCameraTracker::GetInputTotals(const FPlayerState& Player, double NowSeconds) const
+{
+	FAsyncReprojectionInputTotals Totals;
+	Totals.MousePixels = FVector2f(
+		Player.MouseXTotal.load(std::memory_order_relaxed),
+		Player.MouseYTotal.load(std::memory_order_relaxed));
+	Totals.StickDegrees = Player.LookStick.Read().GetDegreesAt(NowSeconds);
+	return Totals;
+}
+
+FAsyncReprojectionInputTotals FAsyncReprojectionCameraTracker::GetInputTotals_AnyThread(int32 PlayerIndex) const
+{
+	const FPlayerState* Player = Players.Find(PlayerIndex);
+	if (Player == nullptr)
+	{
+		return FAsyncReprojectionInputTotals();
+	}
+
+	return GetInputTotals(*Player, FPlatformTime::Seconds());
 }
 
 FAsyncReprojectionRenderedViewSnapshot FAsyncReprojectionCameraTracker::GetLatestRenderedView_RenderThread(int32 PlayerIndex) const
 {
-	if (PlayerIndex < 0 || PlayerIndex >= MaxTrackedPlayers)
+	const FPlayerState* Player = Players.Find(PlayerIndex);
+	if (Player == nullptr)
 	{
 		return FAsyncReprojectionRenderedViewSnapshot();
 	}
 
-	const FRenderedViewBuffer& Buffer = RenderedViewBuffers[PlayerIndex];
-	const uint32 Index = Buffer.WriteIndex.Load(EMemoryOrder::Relaxed) & 1u;
-	return Buffer.Snapshots[Index];
+	return Player->RenderedView.Read();
+}
+
+int32 FAsyncReprojectionCameraTracker::GetNumLocalPlayers_AnyThread() const
+{
+	return NumLocalPlayers.load(std::memory_order_relaxed);
+}
+
+int32 FAsyncReprojectionCameraTracker::GetNumViewSlots_AnyThread() const
+{
+	return FAsyncReprojectionStereo::Get().IsStereoActive_AnyThread() ? FAsyncReprojectionStereo::NumEyes : GetNumLocalPlayers_AnyThread();
+}
+
+void FAsyncReprojectionCameraTracker::RegisterPlayers_GameThread(int32 NumPlayers)
+{
+	check(IsInGameThread());
+
+	// Both tables publish new entries without moving old ones, so the threads reading them need not be stopped.
+	NumPlayers = FMath::Min(NumPlayers, TAsyncReprojectionPlayerTable<FPlayerState>::MaxNum);
+	FAsyncReprojectionFrameCache& FrameCache = FAsyncReprojectionFrameCache::Get();
+	if (NumPlayers <= Players.Num() && NumPlayers <= FrameCache.GetNumPlayerSlots())
+	{
+		return;
+	}
+
+	Players.Grow_GameThread(NumPlayers);
+	FrameCache.GrowPlayerSlots_GameThread(NumPlayers);
+
+	UE_LOG(LogAsyncReprojection, Log, TEXT("Per-player state grown to %d player(s)."), NumPlayers);
 }
 
 float FAsyncReprojectionCameraTracker::GetTrackedFPS() const
@@ -200,28 +524,24 @@ float FAsyncReprojectionCameraTracker::GetTrackedRefreshHz() const
 
 void FAsyncReprojectionCameraTracker::PublishDelta_RenderThread(int32 PlayerIndex, const FAsyncReprojectionDeltaSnapshot& Snapshot)
 {
-	if (PlayerIndex < 0 || PlayerIndex >= MaxTrackedPlayers)
+	FPlayerState* Player = Players.Find(PlayerIndex);
+	if (Player == nullptr)
 	{
 		return;
 	}
 
-	FDeltaBuffer& Buffer = DeltaBuffers[PlayerIndex];
-	const uint32 NextIndex = (Buffer.WriteIndex.Load(EMemoryOrder::Relaxed) + 1u) & 1u;
-	Buffer.Snapshots[NextIndex] = Snapshot;
-	Buffer.WriteIndex.Store(NextIndex, EMemoryOrder::SequentiallyConsistent);
+	Player->Delta.Publish(Snapshot, GFrameCounterRenderThread, FPlatformTime::Seconds());
 }
 
 void FAsyncReprojectionCameraTracker::PublishRenderedView_RenderThread(int32 PlayerIndex, const FAsyncReprojectionRenderedViewSnapshot& Snapshot)
 {
-	if (PlayerIndex < 0 || PlayerIndex >= MaxTrackedPlayers)
+	FPlayerState* Player = Players.Find(PlayerIndex);
+	if (Player == nullptr)
 	{
 		return;
 	}
 
-	FRenderedViewBuffer& Buffer = RenderedViewBuffers[PlayerIndex];
-	const uint32 NextIndex = (Buffer.WriteIndex.Load(EMemoryOrder::Relaxed) + 1u) & 1u;
-	Buffer.Snapshots[NextIndex] = Snapshot;
-	Buffer.WriteIndex.Store(NextIndex, EMemoryOrder::SequentiallyConsistent);
+	Player->RenderedView.Publish(Snapshot, GFrameCounterRenderThread, FPlatformTime::Seconds());
 }
 
 void FAsyncReprojectionCameraTracker::OnEndFrame_GameThread()
@@ -232,7 +552,9 @@ void FAsyncReprojectionCameraTracker::OnEndFrame_GameThread()
 	const float DeltaSeconds = FApp::GetDeltaTime();
 
 	UpdatePerformance_GameThread(NowSeconds, DeltaSeconds);
-	UpdateCameras_GameThread(NowSeconds);
+	FAsyncReprojectionStereo::Get().Update_GameThread(CVarState);
+	UpdateCameras_GameThread(CVarState, NowSeconds);
+	FAsyncReprojectionCompositor::Get().Update_GameThread(CVarState);
 
 	TrackedRefreshHz.Store(GetBestEffortRefreshHz(CVarState.RefreshHzOverride), EMemoryOrder::Relaxed);
 }
@@ -290,7 +612,7 @@ void FAsyncReprojectionCameraTracker::UpdatePerformance_GameThread(double NowSec
 	TrackedFPSStdDev.Store(FMath::Sqrt(Variance), EMemoryOrder::Relaxed);
 }
 
-void FAsyncReprojectionCameraTracker::UpdateCameras_GameThread(double NowSeconds)
+void FAsyncReprojectionCameraTracker::UpdateCameras_GameThread(const FAsyncReprojectionCVarState& CVarState, double NowSeconds)
 {
 	if (GEngine == nullptr || GEngine->GameViewport == nullptr)
 	{
@@ -311,9 +633,17 @@ void FAsyncReprojectionCameraTracker::UpdateCameras_GameThread(double NowSeconds
 	}
 
 	const TArray<ULocalPlayer*>& LocalPlayers = GameInstance->GetLocalPlayers();
-	for (int32 PlayerIndex = 0; PlayerIndex < LocalPlayers.Num() && PlayerIndex < MaxTrackedPlayers; PlayerIndex++)
+	NumLocalPlayers.store(FMath::Max(1, LocalPlayers.Num()), std::memory_order_relaxed);
+	RegisterPlayers_GameThread(FMath::Max(LocalPlayers.Num(), GetNumViewSlots_AnyThread()));
+	for (int32 PlayerIndex = 0; PlayerIndex < LocalPlayers.Num(); PlayerIndex++)
 	{
-		const uint64 ExternalSubmitFrame = ExternalCameraSubmitFrameCounter[PlayerIndex].Load(EMemoryOrder::Relaxed);
+		FPlayerState* Player = Players.Find(PlayerIndex);
+		if (Player == nullptr)
+		{
+			break;
+		}
+
+		const uint64 ExternalSubmitFrame = Player->ExternalCameraSubmitFrameCounter.Load(EMemoryOrder::Relaxed);
 		if (ExternalSubmitFrame == GFrameCounter)
 		{
 			continue;
@@ -331,14 +661,71 @@ void FAsyncReprojectionCameraTracker::UpdateCameras_GameThread(double NowSeconds
 			continue;
 		}
 
-		FAsyncReprojectionCameraSnapshot Snapshot;
-		Snapshot.bIsValid = true;
-		Snapshot.TimeSeconds = NowSeconds;
-		Snapshot.CameraTransform = FTransform(PC->PlayerCameraManager->GetCameraRotation(), PC->PlayerCameraManager->GetCameraLocation(), FVector::OneVector);
+		const FRotator CameraRotation = PC->PlayerCameraManager->GetCameraRotation();
+		const FTransform CameraTransform(CameraRotation, PC->PlayerCameraManager->GetCameraLocation(), FVector::OneVector);
+		const FAsyncReprojectionCameraSnapshot Previous = Player->Camera.Read();
+		PublishCamera_GameThread(*Player, CameraTransform, NowSeconds);
+
+		// Pair the mouse movement this frame consumed with the rotation it produced. Frames where the camera cannot
+		// follow the mouse (paused, cursor shown, camera cut, stick turning, or after a hitch) would bias the fit. There
+		// is one fit, and the mouse belongs to the first local player; other players would feed it cameras it never turned.
+		if (PlayerIndex != 0)
+		{
+			continue;
+		}
+
+		const bool bCanCalibrate = Previous.bIsValid
+			&& (NowSeconds - Previous.TimeSeconds) <= AsyncReprojectionCameraTrackerPrivate::MaxVelocitySampleSeconds
+			&& !PC->IsPaused()
+			&& !PC->ShouldShowMouseCursor()
+			&& !PC->PlayerCameraManager->bGameCameraCutThisFrame
+			&& Player->LookStickDeflection.IsNearlyZero();
+		if (bCanCalibrate || !CVarState.bInputAutoCalibrate)
+		{
+			const FVector2f MousePixels = FVector2f(
+				Player->MouseXTotal.load(std::memory_order_relaxed),
+				Player->MouseYTotal.load(std::memory_order_relaxed)) - Previous.InputTotals.MousePixels;
+			FAsyncReprojectionInputCalibration::Get().AddSample_GameThread(CVarState, MousePixels, Previous.CameraTransform.Rotator(), CameraRotation);
+		}
+	}
+}
+
+void FAsyncReprojectionCameraTracker::PublishCamera_GameThread(FPlayerState& Player, const FTransform& CameraTransform, double NowSeconds)
+{
+	using namespace AsyncReprojectionCameraTrackerPrivate;
+
+	// Only the game thread publishes cameras, so the previous snapshot cannot change under this read.
+	const FAsyncReprojectionCameraSnapshot Previous = Player.Camera.Read();
 
-		FCameraBuffer& Buffer = CameraBuffers[PlayerIndex];
-		const uint32 NextIndex = (Buffer.WriteIndex.Load(EMemoryOrder::Relaxed) + 1u) & 1u;
-		Buffer.Snapshots[NextIndex] = Snapshot;
-		Buffer.WriteIndex.Store(NextIndex, EMemoryOrder::SequentiallyConsistent);
+	FAsyncReprojectionCameraSnapshot Snapshot;
+	Snapshot.bIsValid = true;
+	Snapshot.TimeSeconds = NowSeconds;
+	Snapshot.CameraTransform = CameraTransform;
+	Snapshot.InputTotals = GetInputTotals(Player, NowSeconds);
+
+	const double SampleSeconds = NowSeconds - Previous.TimeSeconds;
+	if (Previous.bIsValid && SampleSeconds >= MinVelocitySampleSeconds && SampleSeconds <= MaxVelocitySampleSeconds)
+	{
+		FQuat DeltaRotation = CameraTransform.GetRotation() * Previous.CameraTransform.GetRotation().Inverse();
+		if (DeltaRotation.W < 0.0)
+		{
+			// Same rotation; take the short way round.
+			DeltaRotation = FQuat(-DeltaRotation.X, -DeltaRotation.Y, -DeltaRotation.Z, -DeltaRotation.W);
+		}
+
+		FVector Axis = FVector::UpVector;
+		double Angle = 0.0;
+		DeltaRotation.ToAxisAndAngle(Axis, Angle);
+
+		Snapshot.AngularVelocity = Axis * (Angle / SampleSeconds);
+		Snapshot.LinearVelocity = (CameraTransform.GetLocation() - Previous.CameraTransform.GetLocation()) / SampleSeconds;
+	}
+	else if (Previous.bIsValid && SampleSeconds < MinVelocitySampleSeconds)
+	{
+		// A second publish within the same frame (e.g. an explicit submit after the end-of-frame sample).
+		Snapshot.AngularVelocity = Previous.AngularVelocity;
+		Snapshot.LinearVelocity = Previous.LinearVelocity;
 	}
+
+	Player.Camera.Publish(Snapshot, GFrameCounter, NowSeconds);
 }
@@ -3,15 +3,53 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AsyncReprojectionPlayerTable.h"
+#include "AsyncReprojectionPoseProvider.h"
+#include "AsyncReprojectionSnapshotChannel.h"
 #include "AsyncReprojectionTypes.h"
 
 #include <atomic>
 
+struct FAsyncReprojectionCVarState;
+
+namespace AsyncReprojectionCameraTrackerPrivate
+{
+	class FSnapshotPoseProvider;
+	class FSnapshotInputPoseProvider;
+	class FPredictedPoseProvider;
+}
+
+/**
+ * @struct FAsyncReprojectionInputTotals
+ *
+ * Look input accumulated since startup: mouse movement in pixels and analog-stick turn integrated to degrees.
+ * Input-driven warps apply the difference between two totals.
+ */
+struct FAsyncReprojectionInputTotals
+{
+	FVector2f MousePixels = FVector2f::ZeroVector;
+	/** Yaw and pitch degrees (positive = right and up). */
+	FVector2f StickDegrees = FVector2f::ZeroVector;
+
+	/** Yaw and pitch degrees (positive = right and up) turned between Since and these totals. */
+	FVector2f GetTurnDegreesSince(const FAsyncReprojectionInputTotals& Since, float YawDegreesPerPixel, float PitchDegreesPerPixel) const
+	{
+		const FVector2f MouseDelta = MousePixels - Since.MousePixels;
+		const FVector2f StickDelta = StickDegrees - Since.StickDegrees;
+		return FVector2f(MouseDelta.X * YawDegreesPerPixel + StickDelta.X, (-MouseDelta.Y) * PitchDegreesPerPixel + StickDelta.Y);
+	}
+};
+
 struct FAsyncReprojectionCameraSnapshot
 {
 	bool bIsValid = false;
 	FTransform CameraTransform = FTransform::Identity;
 	double TimeSeconds = 0.0;
+
+	/** Input totals when the snapshot was published, and the camera velocity since the previous snapshot. */
+	FAsyncReprojectionInputTotals InputTotals;
+	FVector AngularVelocity = FVector::ZeroVector;
+	FVector LinearVelocity = FVector::ZeroVector;
 };
 
 struct FAsyncReprojectionDeltaSnapshot
@@ -28,8 +66,7 @@ struct FAsyncReprojectionRenderedViewSnapshot
 	bool bIsValid = false;
 	FQuat RenderedRotation = FQuat::Identity;
 	FVector RenderedLocation = FVector::ZeroVector;
-	float InputMouseXTotal = 0.0f;
-	float InputMouseYTotal = 0.0f;
+	FAsyncReprojectionInputTotals InputTotals;
 	FMatrix44f ViewToClip = FMatrix44f::Identity;
 	FMatrix44f ClipToView = FMatrix44f::Identity;
 	FIntRect ViewRect = FIntRect(0, 0, 0, 0);
@@ -44,9 +81,48 @@ public:
 	void Startup();
 	void Shutdown();
 
+	/** Last camera published on the game thread. */
 	FAsyncReprojectionCameraSnapshot GetLatestCamera(int32 PlayerIndex) const;
 	FAsyncReprojectionDeltaSnapshot GetLatestDelta(int32 PlayerIndex) const;
 
+	/**
+	 * Latest camera for a non-stereo warp being recorded: the selected pose provider's pose, or the game-thread snapshot
+	 * when the provider has none.
+	 *
+	 * @param PlayerIndex Local player index.
+	 * @param CVarState Current CVar state (selects the built-in provider and its input and prediction limits).
+	 */
+	FAsyncReprojectionCameraSnapshot GetLatestCamera_RenderThread(int32 PlayerIndex, const FAsyncReprojectionCVarState& CVarState) const;
+
+	/**
+	 * @struct FPinnedPoseProvider
+	 *
+	 * The pose provider the rendering thread selects, held so it can still be queried off the rendering thread after an
+	 * override has replaced it.
+	 */
+	struct FPinnedPoseProvider
+	{
+		const IAsyncReprojectionPoseProvider* Provider = nullptr;
+		TSharedPtr<IAsyncReprojectionPoseProvider, ESPMode::ThreadSafe> Override;
+	};
+
+	/** Pins the pose provider GetLatestCamera_RenderThread would query now, for a later GetLatestCamera_AnyThread. */
+	FPinnedPoseProvider PinPoseProvider_RenderThread(const FAsyncReprojectionCVarState& CVarState) const;
+
+	/**
+	 * GetLatestCamera_RenderThread for a pose latched on another thread, such as in an RDG upload callback. Reads no
+	 * rendering-thread state: the provider was pinned when the warp was recorded, and a missing pose falls back to the
+	 * game-thread snapshot without a warning.
+	 */
+	FAsyncReprojectionCameraSnapshot GetLatestCamera_AnyThread(int32 PlayerIndex, const FAsyncReprojectionCVarState& CVarState, const FPinnedPoseProvider& PoseProvider) const;
+
+	/**
+	 * Replaces the built-in pose provider selection (see SetAsyncReprojectionPoseProviderOverride).
+	 *
+	 * @param PoseProvider Provider to query on the rendering thread, or nullptr to restore r.AsyncReprojection.PoseProvider.
+	 */
+	void SetPoseProviderOverride_GameThread(TSharedPtr<IAsyncReprojectionPoseProvider, ESPMode::ThreadSafe> PoseProvider);
+
 	/**
 	 * Overrides the current-frame camera snapshot used by AsyncReprojection.
 	 *
@@ -58,19 +134,51 @@ public:
 	/**
 	 * Accumulates mouse deltas for InputDrivenPose.
 	 *
-	 * @param PlayerIndex Local player index.
+	 * @param PlayerIndex Local player index; input for an index without a registered local player is dropped.
 	 * @param DeltaX Mouse delta X in pixels (positive = moved right).
 	 * @param DeltaY Mouse delta Y in pixels (positive = moved down).
 	 */
 	void AddMouseDelta_GameThread(int32 PlayerIndex, float DeltaX, float DeltaY);
 
 	/**
-	 * Gets the current mouse totals for InputDrivenPose (render-thread safe).
+	 * Sets one axis of the analog look stick for InputDrivenPose. The deflection is turned into a turn rate with the
+	 * pose provider's response curve, or the r.AsyncReprojection.InputStick.* curve, and integrated until the next event.
+	 *
+	 * @param PlayerIndex Local player index; input for an index without a registered local player is dropped.
+	 * @param Axis EAxis::X for the horizontal axis (positive = right), EAxis::Y for the vertical axis (positive = up).
+	 * @param Deflection Axis value in [-1, 1].
+	 */
+	void SetLookStickAxis_GameThread(int32 PlayerIndex, EAxis::Type Axis, float Deflection);
+
+	/**
+	 * Gets the current input totals for InputDrivenPose (thread safe). Stick turn is integrated up to now.
 	 *
 	 * @param PlayerIndex Local player index.
-	 * @return Mouse totals in pixels (X,Y).
+	 * @return Mouse pixels and stick degrees accumulated since startup.
+	 */
+	FAsyncReprojectionInputTotals GetInputTotals_AnyThread(int32 PlayerIndex) const;
+
+	/**
+	 * Gets the number of local players whose cameras are tracked this frame (thread safe).
+	 *
+	 * @return Local player count (at least 1).
 	 */
-	FVector2f GetMouseTotals_RenderThread(int32 PlayerIndex) const;
+	int32 GetNumLocalPlayers_AnyThread() const;
+
+	/**
+	 * Gets the number of cached views to warp: one per stereo eye while stereo is active, one per local player otherwise.
+	 *
+	 * @return View slot count (at least 1).
+	 */
+	int32 GetNumViewSlots_AnyThread() const;
+
+	/**
+	 * Grows the per-player state tables of the tracker and the frame cache to hold NumPlayers players, up to
+	 * TAsyncReprojectionPlayerTable::MaxNum. Readers on other threads keep running while the tables grow.
+	 *
+	 * @param NumPlayers Number of player indices that must be addressable.
+	 */
+	void RegisterPlayers_GameThread(int32 NumPlayers);
 
 	float GetTrackedFPS() const;
 	float GetTrackedFPSStdDev() const;
@@ -88,34 +196,69 @@ private:
 	void OnEndFrame_GameThread();
 
 	void UpdatePerformance_GameThread(double NowSeconds, float DeltaSeconds);
-	void UpdateCameras_GameThread(double NowSeconds);
+	void UpdateCameras_GameThread(const FAsyncReprojectionCVarState& CVarState, double NowSeconds);
+
+	struct FPlayerState;
+	FAsyncReprojectionInputTotals GetInputTotals(const FPlayerState& Player, double NowSeconds) const;
+
+	/** Queries PoseProvider for the player's latest camera; false, with the game-thread snapshot, when it has no pose. */
+	bool QueryLatestCamera(int32 PlayerIndex, const FAsyncReprojectionCVarState& CVarState, const IAsyncReprojectionPoseProvider& PoseProvider, FAsyncReprojectionCameraSnapshot& OutCamera) const;
+
+	FVector2f EvaluateStickTurnRate_GameThread(int32 PlayerIndex, const FVector2f& Deflection) const;
+	void PublishCamera_GameThread(FPlayerState& Player, const FTransform& CameraTransform, double NowSeconds);
+
+	const IAsyncReprojectionPoseProvider& SelectPoseProvider_RenderThread(const FAsyncReprojectionCVarState& CVarState) const;
 
 private:
-	struct FCameraBuffer
+	/**
+	 * @struct FStickIntegral
+	 *
+	 * Analog-stick turn integrated up to EventTimeSeconds; the stick keeps turning at TurnRate until its next event.
+	 */
+	struct FStickIntegral
 	{
-		TAtomic<uint32> WriteIndex { 0 };
-		FAsyncReprojectionCameraSnapshot Snapshots[2];
-	};
+		FVector2f IntegratedDegrees = FVector2f::ZeroVector;
+		FVector2f TurnRateDegreesPerSecond = FVector2f::ZeroVector;
+		double EventTimeSeconds = 0.0;
 
-	struct FDeltaBuffer
-	{
-		TAtomic<uint32> WriteIndex { 0 };
-		FAsyncReprojectionDeltaSnapshot Snapshots[2];
+		FVector2f GetDegreesAt(double NowSeconds) const
+		{
+			return IntegratedDegrees + TurnRateDegreesPerSecond * float(FMath::Max(0.0, NowSeconds - EventTimeSeconds));
+		}
 	};
 
-	struct FRenderedViewBuffer
+	/**
+	 * @struct FPlayerState
+	 *
+	 * One local player's tracking state. Game-thread and rendering-thread writes live on separate cache lines.
+	 */
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FPlayerState
 	{
-		TAtomic<uint32> WriteIndex { 0 };
-		FAsyncReprojectionRenderedViewSnapshot Snapshots[2];
+		/** Written by the game thread. */
+		TAsyncReprojectionSnapshotChannel<FAsyncReprojectionCameraSnapshot> Camera;
+		TAtomic<uint64> ExternalCameraSubmitFrameCounter { 0 };
+		std::atomic<float> MouseXTotal { 0.0f };
+		std::atomic<float> MouseYTotal { 0.0f };
+		TAsyncReprojectionSnapshotChannel<FStickIntegral> LookStick;
+		FVector2f LookStickDeflection = FVector2f::ZeroVector;
+
+		/** Written by the rendering thread. */
+		alignas(PLATFORM_CACHE_LINE_SIZE) TAsyncReprojectionSnapshotChannel<FAsyncReprojectionDeltaSnapshot> Delta;
+		TAsyncReprojectionSnapshotChannel<FAsyncReprojectionRenderedViewSnapshot> RenderedView;
 	};
 
-	static constexpr int32 MaxTrackedPlayers = 4;
-	FCameraBuffer CameraBuffers[MaxTrackedPlayers];
-	FDeltaBuffer DeltaBuffers[MaxTrackedPlayers];
-	FRenderedViewBuffer RenderedViewBuffers[MaxTrackedPlayers];
-	TAtomic<uint64> ExternalCameraSubmitFrameCounter[MaxTrackedPlayers];
-	std::atomic<float> MouseXTotal[MaxTrackedPlayers];
-	std::atomic<float> MouseYTotal[MaxTrackedPlayers];
+	TAsyncReprojectionPlayerTable<FPlayerState> Players { 1 };
+	std::atomic<int32> NumLocalPlayers { 1 };
+
+	TUniquePtr<AsyncReprojectionCameraTrackerPrivate::FSnapshotPoseProvider> SnapshotPoseProvider;
+	TUniquePtr<AsyncReprojectionCameraTrackerPrivate::FSnapshotInputPoseProvider> SnapshotInputPoseProvider;
+	TUniquePtr<AsyncReprojectionCameraTrackerPrivate::FPredictedPoseProvider> PredictedPoseProvider;
+
+	/** Owned by the rendering thread. */
+	TSharedPtr<IAsyncReprojectionPoseProvider, ESPMode::ThreadSafe> OverridePoseProvider;
+
+	/** The same override, for the stick response curve evaluated on the game thread. */
+	TSharedPtr<IAsyncReprojectionPoseProvider, ESPMode::ThreadSafe> GameThreadOverridePoseProvider;
 
 	struct FFpsSample
 	{
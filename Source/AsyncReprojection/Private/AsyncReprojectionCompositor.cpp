@@ -0,0 +1,396 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#include "AsyncReprojectionCompositor.h"
+
+#include "AsyncReprojection.h"
+#include "AsyncReprojectionCameraTracker.h"
+#include "AsyncReprojectionCVars.h"
+#include "AsyncReprojectionFrameCache.h"
+#include "AsyncReprojectionStats.h"
+#include "AsyncReprojectionWarpPass.h"
+
+#include "Async/TaskGraphInterfaces.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/Event.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "RHICommandList.h"
+#include "Rendering/SlateRenderer.h"
+#include "RenderingThread.h"
+#include "Widgets/SWindow.h"
+
+DEFINE_STAT(STAT_AsyncReprojectionHitchesMasked);
+DEFINE_STAT(STAT_AsyncReprojectionHitchTimeMasked);
+
+namespace AsyncReprojectionCompositorPrivate
+{
+	/** Used until the tracker reports a refresh rate or frame rate. */
+	static constexpr double FallbackRefreshHz = 60.0;
+
+	static bool GetLockToVsync_RenderThread()
+	{
+		static const IConsoleVariable* VSyncCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.VSync"));
+		return VSyncCVar != nullptr && VSyncCVar->GetInt() != 0;
+	}
+
+	/** FreezeAndWarp-style settings for a masked hitch: translation and object motion extrapolated over a long stall drift visibly. */
+	static FAsyncReprojectionCVarState MakeHitchMaskCVarState(const FAsyncReprojectionCVarState& CVarState)
+	{
+		FAsyncReprojectionCVarState HitchState = CVarState;
+		HitchState.TimewarpMode = EAsyncReprojectionTimewarpMode::FreezeAndWarp;
+		HitchState.bEnableTranslationWarp = false;
+		HitchState.bAsyncPresentObjectMotion = false;
+
+		// The hitch itself fails Auto's frame-rate stability gate.
+		if (HitchState.Mode == EAsyncReprojectionMode::Auto)
+		{
+			HitchState.Mode = EAsyncReprojectionMode::On;
+		}
+
+		// The cache would otherwise fade out over MaxCacheAgeMs; HitchMask.MaxSeconds bounds its age instead.
+		HitchState.AsyncPresentMaxCacheAgeMs = 0;
+		return HitchState;
+	}
+}
+
+FAsyncReprojectionCompositor& FAsyncReprojectionCompositor::Get()
+{
+	static FAsyncReprojectionCompositor Instance;
+	return Instance;
+}
+
+void FAsyncReprojectionCompositor::Startup()
+{
+	if (!FSlateApplication::IsInitialized())
+	{
+		return;
+	}
+
+	FSlateRenderer* SlateRenderer = FSlateApplication::Get().GetRenderer();
+	if (SlateRenderer == nullptr)
+	{
+		return;
+	}
+
+	PreResizeBackBufferHandle = SlateRenderer->OnPreResizeWindowBackBuffer().AddRaw(this, &FAsyncReprojectionCompositor::OnViewportReleased_GameThread);
+	SlateWindowDestroyedHandle = SlateRenderer->OnSlateWindowDestroyed().AddRaw(this, &FAsyncReprojectionCompositor::OnViewportReleased_GameThread);
+}
+
+void FAsyncReprojectionCompositor::Shutdown()
+{
+	StopThread_GameThread();
+	BindViewportClient_GameThread(nullptr);
+
+	if (FSlateApplication::IsInitialized())
+	{
+		FSlateRenderer* SlateRenderer = FSlateApplication::Get().GetRenderer();
+		if (SlateRenderer != nullptr)
+		{
+			SlateRenderer->OnPreResizeWindowBackBuffer().Remove(PreResizeBackBufferHandle);
+			SlateRenderer->OnSlateWindowDestroyed().Remove(SlateWindowDestroyedHandle);
+		}
+	}
+	PreResizeBackBufferHandle.Reset();
+	SlateWindowDestroyedHandle.Reset();
+}
+
+void FAsyncReprojectionCompositor::Update_GameThread(const FAsyncReprojectionCVarState& CVarState)
+{
+	check(IsInGameThread());
+
+	// Without a separate rendering thread the compositor's task would wait for the stalled game thread.
+	const bool bWantThread = (CVarState.bCompositor || CVarState.bHitchMask) && GIsThreadedRendering && (!GIsEditor || CVarState.bEnableInEditor);
+	if (!bWantThread)
+	{
+		StopThread_GameThread();
+		BindViewportClient_GameThread(nullptr);
+		return;
+	}
+
+	BindViewportClient_GameThread(GEngine != nullptr ? GEngine->GameViewport.Get() : nullptr);
+
+	FRHIViewport* GameViewport = nullptr;
+	if (GEngine != nullptr && GEngine->GameViewport != nullptr && FSlateApplication::IsInitialized())
+	{
+		const TSharedPtr<SWindow> Window = GEngine->GameViewport->GetWindow();
+		FSlateRenderer* SlateRenderer = FSlateApplication::Get().GetRenderer();
+		if (Window.IsValid() && SlateRenderer != nullptr)
+		{
+			const FViewportRHIRef* ViewportRefPtr = static_cast<const FViewportRHIRef*>(SlateRenderer->GetViewportResource(*Window));
+			if (ViewportRefPtr != nullptr && ViewportRefPtr->IsValid())
+			{
+				GameViewport = ViewportRefPtr->GetReference();
+			}
+		}
+	}
+
+	if (GameViewport != PublishedViewport)
+	{
+		PublishedViewport = GameViewport;
+		ENQUEUE_RENDER_COMMAND(AsyncReprojectionCompositorViewport)(
+			[this, GameViewport](FRHICommandListImmediate& RHICmdList)
+			{
+				Viewport = GameViewport;
+			});
+	}
+
+	StartThread_GameThread();
+}
+
+void FAsyncReprojectionCompositor::OnViewportReleased_GameThread(void* ViewportResource)
+{
+	const FViewportRHIRef* ViewportRefPtr = static_cast<const FViewportRHIRef*>(ViewportResource);
+	if (ViewportRefPtr == nullptr || !ViewportRefPtr->IsValid() || ViewportRefPtr->GetReference() != PublishedViewport)
+	{
+		return;
+	}
+
+	PublishedViewport = nullptr;
+	ENQUEUE_RENDER_COMMAND(AsyncReprojectionCompositorReleaseViewport)(
+		[this](FRHICommandListImmediate& RHICmdList)
+		{
+			Viewport = nullptr;
+		});
+}
+
+void FAsyncReprojectionCompositor::BindViewportClient_GameThread(UGameViewportClient* ViewportClient)
+{
+	if (BoundViewportClient.Get() == ViewportClient && (ViewportClient == nullptr || BeginDrawHandle.IsValid()))
+	{
+		return;
+	}
+
+	if (UGameViewportClient* PreviousClient = BoundViewportClient.Get())
+	{
+		PreviousClient->OnBeginDraw().Remove(BeginDrawHandle);
+	}
+	BeginDrawHandle.Reset();
+	BoundViewportClient = ViewportClient;
+
+	if (ViewportClient != nullptr)
+	{
+		BeginDrawHandle = ViewportClient->OnBeginDraw().AddRaw(this, &FAsyncReprojectionCompositor::OnViewportBeginDraw_GameThread);
+	}
+}
+
+void FAsyncReprojectionCompositor::OnViewportBeginDraw_GameThread()
+{
+	// Queued ahead of the frame's canvas and scene rendering, which are the first commands that draw into the back buffer.
+	ENQUEUE_RENDER_COMMAND(AsyncReprojectionCompositorBeginDraw)(
+		[this](FRHICommandListImmediate& RHICmdList)
+		{
+			bViewportDrawing = true;
+		});
+}
+
+void FAsyncReprojectionCompositor::StartThread_GameThread()
+{
+	if (Thread != nullptr)
+	{
+		return;
+	}
+
+	bStopRequested.store(false, std::memory_order_relaxed);
+	LastSlatePresentSeconds.store(0.0, std::memory_order_relaxed);
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, TEXT("AsyncReprojectionCompositor"), 0, TPri_AboveNormal);
+	if (Thread == nullptr)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+		UE_LOG(LogAsyncReprojection, Error, TEXT("Failed to create the compositor thread; r.AsyncReprojection.Compositor and HitchMask have no effect."));
+		return;
+	}
+
+	UE_LOG(LogAsyncReprojection, Log, TEXT("Compositor thread started."));
+}
+
+void FAsyncReprojectionCompositor::StopThread_GameThread()
+{
+	if (Thread == nullptr)
+	{
+		return;
+	}
+
+	Thread->Kill(true);
+	delete Thread;
+	Thread = nullptr;
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+
+	// A present task already queued finds no viewport and does nothing.
+	PublishedViewport = nullptr;
+	ENQUEUE_RENDER_COMMAND(AsyncReprojectionCompositorStop)(
+		[this](FRHICommandListImmediate& RHICmdList)
+		{
+			Viewport = nullptr;
+		});
+
+	UE_LOG(LogAsyncReprojection, Log, TEXT("Compositor thread stopped."));
+}
+
+void FAsyncReprojectionCompositor::Stop()
+{
+	bStopRequested.store(true, std::memory_order_relaxed);
+	if (WakeEvent != nullptr)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+uint32 FAsyncReprojectionCompositor::Run()
+{
+	while (!bStopRequested.load(std::memory_order_relaxed))
+	{
+		WakeEvent->Wait(FTimespan::FromSeconds(GetRefreshIntervalSeconds()));
+		if (bStopRequested.load(std::memory_order_relaxed))
+		{
+			break;
+		}
+
+		const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
+		const double NowSeconds = FPlatformTime::Seconds();
+		if (!IsSlateStalled(CVarState, NowSeconds) || (!CVarState.bCompositor && !IsWorldOverdue(CVarState, NowSeconds)))
+		{
+			continue;
+		}
+
+		// One present in flight at a time; a busy rendering thread must not build up a queue of stale presents.
+		if (bPresentQueued.exchange(true))
+		{
+			continue;
+		}
+
+		FFunctionGraphTask::CreateAndDispatchWhenReady(
+			[this]()
+			{
+				Present_RenderThread();
+				bPresentQueued.store(false);
+			},
+			TStatId(),
+			nullptr,
+			ENamedThreads::GetRenderThread());
+	}
+
+	return 0;
+}
+
+void FAsyncReprojectionCompositor::NotifySlatePresent_RenderThread()
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+	LastSlatePresentSeconds.store(NowSeconds, std::memory_order_relaxed);
+	bViewportDrawing = false;
+
+	if (NumStallPresents > 0)
+	{
+		const double StallMs = (NowSeconds - StallStartSeconds) * 1000.0;
+		if (bStallMaskedHitch)
+		{
+			NumHitchesMasked++;
+			HitchTimeMaskedMs += StallMs;
+			SET_DWORD_STAT(STAT_AsyncReprojectionHitchesMasked, NumHitchesMasked);
+			SET_FLOAT_STAT(STAT_AsyncReprojectionHitchTimeMasked, float(HitchTimeMaskedMs));
+			UE_LOG(LogAsyncReprojection, Log, TEXT("Hitch masked: %d cached frames presented during a %.1f ms stall (%d hitches, %.1f ms masked in total)."), NumStallPresents, StallMs, NumHitchesMasked, HitchTimeMaskedMs);
+		}
+		else
+		{
+			UE_LOG(LogAsyncReprojection, Log, TEXT("Compositor presented %d cached frames during a %.1f ms stall."), NumStallPresents, StallMs);
+		}
+		NumStallPresents = 0;
+		bStallMaskedHitch = false;
+	}
+}
+
+double FAsyncReprojectionCompositor::GetRefreshIntervalSeconds() const
+{
+	const float RefreshHz = FAsyncReprojectionCameraTracker::Get().GetTrackedRefreshHz();
+	return 1.0 / (RefreshHz > 1.0f ? double(RefreshHz) : AsyncReprojectionCompositorPrivate::FallbackRefreshHz);
+}
+
+bool FAsyncReprojectionCompositor::IsSlateStalled(const FAsyncReprojectionCVarState& CVarState, double NowSeconds) const
+{
+	const double LastPresentSeconds = LastSlatePresentSeconds.load(std::memory_order_relaxed);
+	if (LastPresentSeconds <= 0.0)
+	{
+		return false;
+	}
+
+	const double StallSeconds = GetRefreshIntervalSeconds() * double(FMath::Max(1.0f, CVarState.CompositorStallRefreshIntervals));
+	return (NowSeconds - LastPresentSeconds) >= StallSeconds;
+}
+
+bool FAsyncReprojectionCompositor::IsWorldOverdue(const FAsyncReprojectionCVarState& CVarState, double NowSeconds) const
+{
+	if (!CVarState.bHitchMask)
+	{
+		return false;
+	}
+
+	double LastCaptureSeconds = 0.0;
+	const int32 NumViewSlots = FMath::Max(1, FAsyncReprojectionCameraTracker::Get().GetNumViewSlots_AnyThread());
+	for (int32 PlayerIndex = 0; PlayerIndex < NumViewSlots; PlayerIndex++)
+	{
+		LastCaptureSeconds = FMath::Max(LastCaptureSeconds, FAsyncReprojectionFrameCache::Get().GetLastCaptureTimeSeconds_AnyThread(PlayerIndex));
+	}
+	if (LastCaptureSeconds <= 0.0)
+	{
+		return false;
+	}
+
+	// Frame time at the slow end of the tracked variation, so ordinary frame-time jitter is not taken for a hitch.
+	const float FPS = FAsyncReprojectionCameraTracker::Get().GetTrackedFPS();
+	const float FPSStdDev = FAsyncReprojectionCameraTracker::Get().GetTrackedFPSStdDev();
+	const double SlowFrameSeconds = FPS > 1.0f
+		? 1.0 / FMath::Max(1.0, double(FPS) - double(FPSStdDev))
+		: 1.0 / AsyncReprojectionCompositorPrivate::FallbackRefreshHz;
+
+	const double OverdueSeconds = FMath::Max(double(CVarState.HitchMaskMinMs) / 1000.0, double(FMath::Max(1.0f, CVarState.HitchMaskFrameTimeMultiplier)) * SlowFrameSeconds);
+	const double CaptureAgeSeconds = NowSeconds - LastCaptureSeconds;
+	return CaptureAgeSeconds >= OverdueSeconds && CaptureAgeSeconds <= double(CVarState.HitchMaskMaxSeconds);
+}
+
+void FAsyncReprojectionCompositor::Present_RenderThread()
+{
+	check(IsInRenderingThread());
+
+	if (Viewport == nullptr)
+	{
+		return;
+	}
+
+	// A viewport draw begun since Slate's last present may have put part of the scene or HUD into the back buffer already;
+	// presenting over it now would show a torn, half-rendered frame. The engine's frame counter is no guide: the next
+	// frame begins on the rendering thread before the game tick, GC or blocking load that stalls it.
+	if (bViewportDrawing)
+	{
+		return;
+	}
+
+	// Slate may have presented, or the world caught up, while the task waited for the rendering thread.
+	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
+	const double NowSeconds = FPlatformTime::Seconds();
+	const bool bMaskingHitch = IsWorldOverdue(CVarState, NowSeconds);
+	if ((!CVarState.bCompositor && !bMaskingHitch) || !IsSlateStalled(CVarState, NowSeconds))
+	{
+		return;
+	}
+
+	const FAsyncReprojectionCVarState PresentCVarState = bMaskingHitch ? AsyncReprojectionCompositorPrivate::MakeHitchMaskCVarState(CVarState) : CVarState;
+	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
+	if (!FAsyncReprojectionCachedPresentWarp::PresentCachedFrame_RenderThread(RHICmdList, Viewport, PresentCVarState, AsyncReprojectionCompositorPrivate::GetLockToVsync_RenderThread()))
+	{
+		return;
+	}
+
+	if (NumStallPresents == 0)
+	{
+		StallStartSeconds = LastSlatePresentSeconds.load(std::memory_order_relaxed);
+		UE_LOG(LogAsyncReprojection, Verbose, TEXT("Compositor presenting cached frames: no Slate present for %.1f ms."), (NowSeconds - StallStartSeconds) * 1000.0);
+	}
+	NumStallPresents++;
+	bStallMaskedHitch |= bMaskingHitch;
+}
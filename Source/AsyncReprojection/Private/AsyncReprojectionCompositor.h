@@ -0,0 +1,102 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "UObject/WeakObjectPtr.h"
+
+#include <atomic>
+
+class FEvent;
+class FRHIViewport;
+class FRunnableThread;
+class UGameViewportClient;
+
+struct FAsyncReprojectionCVarState;
+
+/**
+ * @class FAsyncReprojectionCompositor
+ *
+ * Keeps the game viewport presenting at display refresh while the game thread stalls (r.AsyncReprojection.Compositor).
+ * A dedicated thread wakes once per refresh interval and watches the Slate present heartbeat; once no present has
+ * arrived for r.AsyncReprojection.Compositor.StallRefreshIntervals intervals, it dispatches a task to the rendering
+ * thread, which is idle while the game thread stalls, that warps the latest cached frames to the freshest poses straight
+ * into the viewport back buffer and presents it. Slate UI is not drawn during a stall.
+ *
+ * With r.AsyncReprojection.HitchMask the thread also runs without r.AsyncReprojection.Compositor, but only presents while
+ * the world frame is overdue: no frame was captured for HitchMask.FrameTimeMultiplier tracked frame times. Those presents
+ * are FreezeAndWarp-style rotation-only warps, and each masked stall is counted in the Hitches Masked stats.
+ *
+ * UE only presents from the rendering thread's command list, so the compositor stalls with the rendering thread: a stall
+ * of the rendering or RHI thread itself still freezes the display. The task runs as soon as that thread becomes free and
+ * skips itself if Slate presented meanwhile, or if the game viewport has started drawing its next frame since Slate last
+ * presented, which may already be in the back buffer. A stall in the game tick, GC or a blocking load happens before
+ * the viewport draws, so the engine having begun a frame on the rendering thread does not stop the compositor.
+ */
+class FAsyncReprojectionCompositor final : public FRunnable
+{
+public:
+	static FAsyncReprojectionCompositor& Get();
+
+	void Startup();
+	void Shutdown();
+
+	/** Starts or stops the compositor thread with r.AsyncReprojection.Compositor or HitchMask and hands it the game viewport. */
+	void Update_GameThread(const FAsyncReprojectionCVarState& CVarState);
+
+	/** Records that Slate is presenting; called for every window Slate presents. */
+	void NotifySlatePresent_RenderThread();
+
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	FAsyncReprojectionCompositor() = default;
+	~FAsyncReprojectionCompositor() = default;
+
+	void StartThread_GameThread();
+	void StopThread_GameThread();
+
+	/** Drops the viewport before its swap chain resizes or its window closes; Update_GameThread hands it over again. */
+	void OnViewportReleased_GameThread(void* ViewportResource);
+
+	/** Follows the game viewport client whose draws into the back buffer stop the compositor until Slate presents. */
+	void BindViewportClient_GameThread(UGameViewportClient* ViewportClient);
+	void OnViewportBeginDraw_GameThread();
+
+	double GetRefreshIntervalSeconds() const;
+	bool IsSlateStalled(const FAsyncReprojectionCVarState& CVarState, double NowSeconds) const;
+
+	/** True while hitch masking is on and the newest cached frame is overdue but younger than HitchMask.MaxSeconds. */
+	bool IsWorldOverdue(const FAsyncReprojectionCVarState& CVarState, double NowSeconds) const;
+
+	void Present_RenderThread();
+
+private:
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	std::atomic<bool> bStopRequested { false };
+
+	/** Game thread: viewport last handed to the rendering thread. */
+	FRHIViewport* PublishedViewport = nullptr;
+	TWeakObjectPtr<UGameViewportClient> BoundViewportClient;
+	FDelegateHandle BeginDrawHandle;
+
+	/** Owned by the rendering thread. */
+	FRHIViewport* Viewport = nullptr;
+
+	/** Set once the game viewport starts drawing a frame, cleared when Slate presents it. */
+	bool bViewportDrawing = false;
+	int32 NumStallPresents = 0;
+	double StallStartSeconds = 0.0;
+	bool bStallMaskedHitch = false;
+	int32 NumHitchesMasked = 0;
+	double HitchTimeMaskedMs = 0.0;
+
+	std::atomic<double> LastSlatePresentSeconds { 0.0 };
+	std::atomic<bool> bPresentQueued { false };
+
+	FDelegateHandle PreResizeBackBufferHandle;
+	FDelegateHandle SlateWindowDestroyedHandle;
+};
@@ -2,6 +2,8 @@
 
 #include "AsyncReprojectionDebugOverlay.h"
 
+#include "AsyncReprojectionWarpMetrics.h"
+
 #include "Engine/Engine.h"
 #include "ScreenPass.h"
 
@@ -36,6 +38,12 @@ namespace AsyncReprojectionDebugOverlay
 				Draw(FString::Printf(TEXT("DeltaRot(deg) Yaw=%.2f Pitch=%.2f Roll=%.2f"), Data.DeltaRotDegrees.Yaw, Data.DeltaRotDegrees.Pitch, Data.DeltaRotDegrees.Roll), FLinearColor::White);
 				Draw(FString::Printf(TEXT("DeltaTrans=%.2fcm  Depth=%s  Translation=%s  Weight=%.2f"), Data.DeltaTransCm, *BoolToOnOff(Data.bDepthAvailable), *BoolToOnOff(Data.bTranslationEnabled), Data.Weight), FLinearColor::White);
 				Draw(FString::Printf(TEXT("AsyncPresent=%s"), *BoolToOnOff(Data.bAsyncPresentEnabled)), FLinearColor::White);
+
+				const FAsyncReprojectionWarpMetricsSnapshot Metrics = FAsyncReprojectionWarpMetrics::Get().GetLatest_AnyThread();
+				if (Metrics.bIsValid)
+				{
+					Draw(FString::Printf(TEXT("WarpFallback=%.1f%%  OutOfBounds=%.1f%%  Disocclusion=%.1f%%"), Metrics.RotationOnlyFallbackRatio * 100.0f, Metrics.OutOfBoundsRatio * 100.0f, Metrics.OcclusionFallbackRatio * 100.0f), FLinearColor::White);
+				}
 			});
 		}
 	}
@@ -0,0 +1,201 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#include "AsyncReprojectionForeground.h"
+
+#include "AsyncReprojection.h"
+#include "AsyncReprojectionAsyncPresent.h"
+#include "AsyncReprojectionCVars.h"
+#include "AsyncReprojectionStereo.h"
+#include "AsyncReprojectionWarpPass.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "SceneRenderTargetParameters.h"
+#include "SceneView.h"
+
+namespace AsyncReprojectionForegroundPrivate
+{
+	static constexpr uint64 VerboseLogFrameInterval = 120;
+	static uint64 LastMissingDepthWarnFrame = 0;
+
+	/** Adds the scene ids of the actor's registered, visible components tagged as foreground. */
+	static void CollectForegroundPrimitives(const AActor* Actor, TSet<FPrimitiveComponentId>& OutPrimitives)
+	{
+		if (Actor == nullptr || Actor->IsHidden())
+		{
+			return;
+		}
+
+		TInlineComponentArray<UPrimitiveComponent*> Components(Actor, true);
+		for (const UPrimitiveComponent* Component : Components)
+		{
+			if (Component != nullptr
+				&& Component->IsRegistered()
+				&& Component->IsVisible()
+				&& Component->ComponentHasTag(FAsyncReprojectionForeground::ComponentTag))
+			{
+				OutPrimitives.Add(Component->GetPrimitiveSceneId());
+			}
+		}
+	}
+}
+
+const FName FAsyncReprojectionForeground::ComponentTag(TEXT("AsyncReprojectionForeground"));
+
+FAsyncReprojectionForeground& FAsyncReprojectionForeground::Get()
+{
+	static FAsyncReprojectionForeground Instance;
+	return Instance;
+}
+
+void FAsyncReprojectionForeground::SetupView_GameThread(const FAsyncReprojectionCVarState& CVarState, FSceneView& InView)
+{
+	using namespace AsyncReprojectionForegroundPrivate;
+
+	check(IsInGameThread());
+
+	// Views the pipeline never caches or warps leave the slot state alone.
+	if (!InView.bIsGameView || InView.bIsSceneCapture || InView.bIsReflectionCapture || InView.bIsPlanarReflection || !InView.IsPerspectiveProjection())
+	{
+		return;
+	}
+
+	const int32 ViewSlotIndex = FAsyncReprojectionStereo::GetViewSlotIndex(InView);
+	bool& bHasPrimitives = HasPrimitivesByViewSlot.FindOrAdd(ViewSlotIndex);
+
+	// Eye views are only cached, and so only have a warp to draw under the foreground, with stereo enabled.
+	const bool bEnabled = CVarState.bForeground
+		&& CVarState.Mode != EAsyncReprojectionMode::Off
+		&& (!FAsyncReprojectionStereo::IsStereoEyeView(InView) || CVarState.bStereo)
+		&& (!GIsEditor || CVarState.bEnableInEditor);
+	if (!bEnabled)
+	{
+		bHasPrimitives = false;
+		return;
+	}
+
+	// Tagged components on the view target and on everything attached to it, such as a weapon held by the pawn.
+	TSet<FPrimitiveComponentId> Primitives;
+	if (const AActor* ViewActor = InView.ViewActor)
+	{
+		CollectForegroundPrimitives(ViewActor, Primitives);
+
+		TArray<AActor*> AttachedActors;
+		ViewActor->GetAttachedActors(AttachedActors, true, true);
+		for (const AActor* AttachedActor : AttachedActors)
+		{
+			CollectForegroundPrimitives(AttachedActor, Primitives);
+		}
+	}
+	bHasPrimitives = Primitives.Num() > 0;
+
+	if (!FAsyncReprojectionAsyncPresent::Get().IsForegroundOnlyFrame())
+	{
+		return;
+	}
+
+	// The world comes from the cached warp: render only the foreground (nothing, for a split-screen player without one,
+	// whose pane is warped in full), and keep temporal history and exposure as the
+	// last full frame left them so the next one does not resolve against a foreground-only history.
+	InView.ShowOnlyPrimitives = MoveTemp(Primitives);
+	InView.bStatePrevViewInfoIsReadOnly = true;
+	InView.FinalPostProcessSettings.AutoExposureSpeedUp = 0.0f;
+	InView.FinalPostProcessSettings.AutoExposureSpeedDown = 0.0f;
+	InView.FinalPostProcessSettings.MotionBlurAmount = 0.0f;
+
+	const uint32 FrameNumber = InView.Family != nullptr ? InView.Family->FrameNumber : 0;
+	ENQUEUE_RENDER_COMMAND(AsyncReprojectionForegroundView)(
+		[this, ViewSlotIndex, FrameNumber](FRHICommandListImmediate& RHICmdList)
+		{
+			ForegroundFrameByViewSlot.Add(ViewSlotIndex, FrameNumber);
+		});
+}
+
+bool FAsyncReprojectionForeground::HasForegroundPrimitives_GameThread() const
+{
+	check(IsInGameThread());
+
+	for (const TPair<int32, bool>& Entry : HasPrimitivesByViewSlot)
+	{
+		if (Entry.Value)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FAsyncReprojectionForeground::IsForegroundView_RenderThread(const FSceneView& View) const
+{
+	const uint32* FrameNumber = ForegroundFrameByViewSlot.Find(FAsyncReprojectionStereo::GetViewSlotIndex(View));
+	return FrameNumber != nullptr && View.Family != nullptr && *FrameNumber == View.Family->FrameNumber;
+}
+
+bool FAsyncReprojectionForeground::IsForegroundViewFamily_RenderThread(const FSceneViewFamily& ViewFamily) const
+{
+	for (const FSceneView* View : ViewFamily.Views)
+	{
+		if (View != nullptr && IsForegroundView_RenderThread(*View))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FAsyncReprojectionForeground::AddCompositePasses_RenderThread(
+	FRDGBuilder& GraphBuilder,
+	const FSceneViewFamily& ViewFamily,
+	const FAsyncReprojectionCVarState& CVarState,
+	FRDGTextureRef ViewFamilyTexture,
+	TRDGUniformBufferRef<FSceneTextureUniformParameters> SceneTextures) const
+{
+	using namespace AsyncReprojectionForegroundPrivate;
+
+	FRDGTextureRef SceneDepth = SceneTextures ? SceneTextures->GetParameters()->SceneDepthTexture : nullptr;
+	if (ViewFamilyTexture == nullptr || SceneDepth == nullptr)
+	{
+		if ((GFrameCounterRenderThread - LastMissingDepthWarnFrame) >= VerboseLogFrameInterval)
+		{
+			UE_LOG(LogAsyncReprojection, Warning, TEXT("Foreground composite skipped: view family texture or scene depth is unavailable."));
+			LastMissingDepthWarnFrame = GFrameCounterRenderThread;
+		}
+		if (ViewFamilyTexture != nullptr)
+		{
+			AddClearRenderTargetPass(GraphBuilder, ViewFamilyTexture, FLinearColor::Black);
+		}
+		FAsyncReprojectionAsyncPresent::Get().ReportCacheMiss_RenderThread();
+		return false;
+	}
+
+	// Scene depth is at render resolution; the warp maps each player's output pixels into its view rect.
+	TMap<int32, FIntRect> DepthRectByViewSlot;
+	for (const FSceneView* View : ViewFamily.Views)
+	{
+		if (View != nullptr && IsForegroundView_RenderThread(*View))
+		{
+			DepthRectByViewSlot.Add(FAsyncReprojectionStereo::GetViewSlotIndex(*View), View->ViewRect);
+		}
+	}
+
+	const bool bComposited = FAsyncReprojectionCachedPresentWarp::AddForegroundCompositePasses_RenderThread(
+		GraphBuilder,
+		CVarState,
+		ViewFamilyTexture,
+		SceneDepth,
+		DepthRectByViewSlot);
+	if (bComposited)
+	{
+		FAsyncReprojectionAsyncPresent::Get().ReportCompositeSuccess_RenderThread(FPlatformTime::Seconds());
+	}
+	else
+	{
+		// The family rendered nothing but its foreground layers; a world-less frame is worse than the black fallback.
+		AddClearRenderTargetPass(GraphBuilder, ViewFamilyTexture, FLinearColor::Black);
+		FAsyncReprojectionAsyncPresent::Get().ReportCacheMiss_RenderThread();
+	}
+	return bComposited;
+}
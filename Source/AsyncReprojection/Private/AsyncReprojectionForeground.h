@@ -0,0 +1,68 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphDefinitions.h"
+
+class FSceneView;
+class FSceneViewFamily;
+
+struct FAsyncReprojectionCVarState;
+struct FSceneTextureUniformParameters;
+
+/**
+ * @class FAsyncReprojectionForeground
+ *
+ * Foreground layer (r.AsyncReprojection.Foreground). Primitive components tagged ComponentTag on a view's view target,
+ * or on actors attached to it, form the view's foreground: camera-attached geometry such as a first-person weapon and
+ * hands, which looks wrong when warped with the world. On frames that skip world rendering the view family is still
+ * built, but each game view renders only its foreground with that frame's camera; the cached warp is then drawn under
+ * it in PostRenderViewFamily, wherever the foreground left scene depth empty.
+ */
+class FAsyncReprojectionForeground final
+{
+public:
+	/** Component tag that marks a primitive as foreground. */
+	static const FName ComponentTag;
+
+	static FAsyncReprojectionForeground& Get();
+
+	/**
+	 * Collects the view's foreground primitives and, on a foreground-only frame, restricts the view to them; called from
+	 * the view extension's SetupView.
+	 */
+	void SetupView_GameThread(const FAsyncReprojectionCVarState& CVarState, FSceneView& InView);
+
+	/** Whether any view found foreground primitives when it was last set up. */
+	bool HasForegroundPrimitives_GameThread() const;
+
+	/** Whether the view was restricted to its foreground layer by SetupView_GameThread. */
+	bool IsForegroundView_RenderThread(const FSceneView& View) const;
+
+	/** Whether any view of the family was restricted to its foreground layer. */
+	bool IsForegroundViewFamily_RenderThread(const FSceneViewFamily& ViewFamily) const;
+
+	/**
+	 * Draws the cached warp of every player under the family's foreground layer, in place.
+	 *
+	 * @param ViewFamilyTexture View family output holding the rendered foreground.
+	 * @param SceneTextures Scene textures of the family; foreground pixels are those with scene depth.
+	 * @return False, after clearing the output to black, when not every player has a usable cached frame.
+	 */
+	bool AddCompositePasses_RenderThread(
+		FRDGBuilder& GraphBuilder,
+		const FSceneViewFamily& ViewFamily,
+		const FAsyncReprojectionCVarState& CVarState,
+		FRDGTextureRef ViewFamilyTexture,
+		TRDGUniformBufferRef<FSceneTextureUniformParameters> SceneTextures) const;
+
+private:
+	FAsyncReprojectionForeground() = default;
+
+	/** Game thread only: whether each view slot found foreground primitives when it was last set up. */
+	TMap<int32, bool> HasPrimitivesByViewSlot;
+
+	/** Owned by the rendering thread: view family frame number each view slot last rendered foreground only. */
+	TMap<int32, uint32> ForegroundFrameByViewSlot;
+};
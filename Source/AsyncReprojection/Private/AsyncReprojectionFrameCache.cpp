@@ -4,15 +4,26 @@
 
 #include "AsyncReprojection.h"
 #include "AsyncReprojectionCVars.h"
+#include "AsyncReprojectionForeground.h"
+#include "AsyncReprojectionOverscan.h"
+#include "AsyncReprojectionStats.h"
+#include "AsyncReprojectionStereo.h"
 
+#include "PixelFormat.h"
 #include "PostProcess/PostProcessMaterialInputs.h"
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
 #include "RenderTargetPool.h"
+#include "RenderUtils.h"
 #include "SceneRenderTargetParameters.h"
 #include "ScreenPass.h"
 #include "ShaderParameterStruct.h"
 
+DECLARE_GPU_STAT_NAMED(AsyncReprojectionCapture, TEXT("AsyncReprojection Capture"));
+DEFINE_STAT(STAT_AsyncReprojectionFrameCacheMemory);
+DEFINE_STAT(STAT_AsyncReprojectionCaptureTraffic);
+DEFINE_STAT(STAT_AsyncReprojectionWarpTraffic);
+
 namespace AsyncReprojectionFrameCachePrivate
 {
 	static constexpr uint64 VerboseLogFrameInterval = 120;
@@ -20,18 +31,38 @@ namespace AsyncReprojectionFrameCachePrivate
 	static uint64 LastMissingSceneTexturesWarnFrame = 0;
 	static uint64 LastInvalidSceneColorWarnFrame = 0;
 	static uint64 LastMissingTargetsErrorFrame = 0;
+	static uint64 LastBudgetWarnFrame = 0;
+	static uint64 LastUnregisteredPlayerWarnFrame = 0;
+	static uint64 LastFarFieldRestartLogFrame = 0;
+
+	static constexpr int32 CaptureTileSize = 8;
+	static constexpr EPixelFormat ObjectMotionFormat = PF_G16R16F;
+
+	class FCaptureObjectMotion : SHADER_PERMUTATION_BOOL("CAPTURE_OBJECT_MOTION");
 
-	class FCacheDepthDeviceZCS : public FGlobalShader
+	/**
+	 * Fused capture kernel: copies SceneColor and extracts device-Z in one dispatch.
+	 * The object motion permutation also converts the velocity buffer into per-pixel object motion for extrapolation.
+	 */
+	class FCaptureFrameCS : public FGlobalShader
 	{
 	public:
-		DECLARE_GLOBAL_SHADER(FCacheDepthDeviceZCS);
-		SHADER_USE_PARAMETER_STRUCT(FCacheDepthDeviceZCS, FGlobalShader);
+		DECLARE_GLOBAL_SHADER(FCaptureFrameCS);
+		SHADER_USE_PARAMETER_STRUCT(FCaptureFrameCS, FGlobalShader);
+
+		using FPermutationDomain = TShaderPermutationDomain<FCaptureObjectMotion>;
 
 		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 			SHADER_PARAMETER_STRUCT_INCLUDE(FViewShaderParameters, View)
 			SHADER_PARAMETER_RDG_UNIFORM_BUFFER(FSceneTextureUniformParameters, SceneTexturesStruct)
-			SHADER_PARAMETER(FVector4f, BufferSizeAndInvSize)
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D, SceneColorTexture)
+			SHADER_PARAMETER(FVector4f, DepthPixelScaleBias)
+			SHADER_PARAMETER(FIntVector4, CaptureRectMinMax)
+			SHADER_PARAMETER(FIntPoint, CaptureTileOrigin)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, OutColor)
 			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, OutDeviceZ)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float2>, OutObjectMotion)
+			SHADER_PARAMETER(FVector2f, MotionToCachedPixelsPerSecond)
 		END_SHADER_PARAMETER_STRUCT()
 
 		static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -40,7 +71,159 @@ namespace AsyncReprojectionFrameCachePrivate
 		}
 	};
 
-	IMPLEMENT_GLOBAL_SHADER(FCacheDepthDeviceZCS, "/Plugin/AsyncReprojection/Private/AsyncReprojectionCacheDepth.usf", "MainCS", SF_Compute);
+	IMPLEMENT_GLOBAL_SHADER(FCaptureFrameCS, "/Plugin/AsyncReprojection/Private/AsyncReprojectionCaptureFrame.usf", "MainCS", SF_Compute);
+
+	static constexpr int32 FarFieldTileSize = 8;
+	static constexpr EPixelFormat FarFieldFormat = PF_FloatRGBA;
+
+	/** The far-field map is cleared once the camera has moved far enough for its nearest content to shift this much. */
+	static constexpr double FarFieldMaxParallaxDegrees = 1.0;
+
+	/** Gathers the distant content of a capture into the octahedral far-field map. */
+	class FUpdateFarFieldCS : public FGlobalShader
+	{
+	public:
+		DECLARE_GLOBAL_SHADER(FUpdateFarFieldCS);
+		SHADER_USE_PARAMETER_STRUCT(FUpdateFarFieldCS, FGlobalShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedColorTexture)
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, CachedDeviceZTexture)
+			SHADER_PARAMETER(FMatrix44f, RenderedSVPositionToTranslatedWorld)
+			SHADER_PARAMETER(FMatrix44f, TranslatedWorldToRenderedSVPosition)
+			SHADER_PARAMETER(FIntVector4, CaptureRectMinMax)
+			SHADER_PARAMETER(float, MinDistance)
+			SHADER_PARAMETER(uint32, FarFieldSize)
+			SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, RWFarField)
+		END_SHADER_PARAMETER_STRUCT()
+
+		static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+		{
+			return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+		}
+	};
+
+	IMPLEMENT_GLOBAL_SHADER(FUpdateFarFieldCS, "/Plugin/AsyncReprojection/Private/AsyncReprojectionFarField.usf", "MainCS", SF_Compute);
+
+	static bool ShouldCaptureOnAsyncCompute(const FAsyncReprojectionCVarState& CVarState)
+	{
+		return CVarState.bFrameCacheAsyncCompute && GSupportsEfficientAsyncCompute;
+	}
+
+	static EPixelFormat ResolveCachedColorFormat(EPixelFormat SceneColorFormat, bool bReducedColorFormat)
+	{
+		// Only RGB is sampled by the cached warp, so R11G11B10 halves the footprint of a half-float scene color.
+		if (bReducedColorFormat && UE::PixelFormat::HasCapabilities(PF_FloatR11G11B10, EPixelFormatCapabilities::TypedUAVStore))
+		{
+			return PF_FloatR11G11B10;
+		}
+
+		if (UE::PixelFormat::HasCapabilities(SceneColorFormat, EPixelFormatCapabilities::TypedUAVStore))
+		{
+			return SceneColorFormat;
+		}
+
+		return PF_FloatRGBA;
+	}
+
+	static EPixelFormat ResolveReducedFormat(EPixelFormat PreferredFormat, EPixelFormat ReducedFormat)
+	{
+		return UE::PixelFormat::HasCapabilities(ReducedFormat, EPixelFormatCapabilities::TypedUAVStore) ? ReducedFormat : PreferredFormat;
+	}
+
+	static int32 GetFarFieldSize(const FAsyncReprojectionCVarState& CVarState)
+	{
+		return FMath::Clamp(CVarState.FarFieldResolution, 32, 2048);
+	}
+
+	static int64 EstimateFarFieldBytes(int32 FarFieldSize)
+	{
+		return FarFieldSize > 0 ? int64(CalculateImageBytes(FarFieldSize, FarFieldSize, 0, FarFieldFormat)) : 0;
+	}
+
+	static int64 EstimateCaptureBytes(const FIntPoint& Extent, EPixelFormat ColorFormat, EPixelFormat DepthFormat, bool bObjectMotion)
+	{
+		return int64(CalculateImageBytes(Extent.X, Extent.Y, 0, ColorFormat))
+			+ int64(CalculateImageBytes(Extent.X, Extent.Y, 0, DepthFormat))
+			+ (bObjectMotion ? int64(CalculateImageBytes(Extent.X, Extent.Y, 0, ObjectMotionFormat)) : 0);
+	}
+
+	/**
+	 * Approximate bytes one capture dispatch moves: the source color read, scene depth (and velocity) reads over the
+	 * render-resolution view, and the cached target writes.
+	 */
+	static int64 EstimateCaptureTrafficBytes(const FIntPoint& Extent, const FIntPoint& RenderSize, EPixelFormat SourceFormat, EPixelFormat ColorFormat, EPixelFormat DepthFormat, bool bObjectMotion)
+	{
+		const int64 SceneBytesPerPixel = GPixelFormats[PF_R32_FLOAT].BlockBytes + (bObjectMotion ? GPixelFormats[PF_A16B16G16R16].BlockBytes : 0);
+		return int64(CalculateImageBytes(Extent.X, Extent.Y, 0, SourceFormat))
+			+ int64(RenderSize.X) * int64(RenderSize.Y) * SceneBytesPerPixel
+			+ EstimateCaptureBytes(Extent, ColorFormat, DepthFormat, bObjectMotion);
+	}
+
+	/**
+	 * Approximate bytes one cached warp of a view moves: every cached texel under the view is fetched once (the texture
+	 * cache absorbs neighbouring taps) and every output pixel is written once.
+	 */
+	static int64 EstimateWarpTrafficBytes(const FIntPoint& CachedSize, const FIntPoint& OutputSize, EPixelFormat ColorFormat, EPixelFormat DepthFormat, EPixelFormat OutputFormat, bool bObjectMotion)
+	{
+		const int64 CachedBytesPerPixel = GPixelFormats[ColorFormat].BlockBytes
+			+ GPixelFormats[DepthFormat].BlockBytes
+			+ (bObjectMotion ? GPixelFormats[ObjectMotionFormat].BlockBytes : 0);
+		return int64(CachedSize.X) * int64(CachedSize.Y) * CachedBytesPerPixel
+			+ int64(OutputSize.X) * int64(OutputSize.Y) * GPixelFormats[OutputFormat].BlockBytes;
+	}
+
+	static double BytesToMB(int64 Bytes)
+	{
+		return double(Bytes) / (1024.0 * 1024.0);
+	}
+
+	/**
+	 * Maps a capture pixel center to the scene depth/velocity pixel it reads by scaling CachedViewRect onto View.ViewRect:
+	 * identity before the upscaler, nearest-texel lookups (no depth filtering) for upscaled or display captures.
+	 */
+	static FVector4f ComputeDepthPixelScaleBias(const FSceneView& View, const FIntRect& CachedViewRect)
+	{
+		if (CachedViewRect.Width() <= 0 || CachedViewRect.Height() <= 0 || CachedViewRect == View.ViewRect)
+		{
+			return FVector4f(1.0f, 1.0f, 0.0f, 0.0f);
+		}
+
+		const FVector2f Scale(
+			float(View.ViewRect.Width()) / float(CachedViewRect.Width()),
+			float(View.ViewRect.Height()) / float(CachedViewRect.Height()));
+		return FVector4f(
+			Scale.X,
+			Scale.Y,
+			float(View.ViewRect.Min.X) - float(CachedViewRect.Min.X) * Scale.X,
+			float(View.ViewRect.Min.Y) - float(CachedViewRect.Min.Y) * Scale.Y);
+	}
+
+	/** Scale from a per-frame screen-position delta to cached-buffer pixels per second of a capture covering CachedViewRect. */
+	static FVector2f ComputeMotionToCachedPixelsPerSecond(const FSceneView& View, const FIntRect& CachedViewRect)
+	{
+		// Clamp so a paused or hitched frame does not turn a small velocity into an extreme extrapolation.
+		const float FrameDeltaSeconds = FMath::Clamp(View.Family->Time.GetDeltaWorldTimeSeconds(), 1.0f / 240.0f, 0.1f);
+		const FIntPoint ViewSize = CachedViewRect.Size();
+		return FVector2f(0.5f * float(ViewSize.X) / FrameDeltaSeconds, -0.5f * float(ViewSize.Y) / FrameDeltaSeconds);
+	}
+
+	static int64 ComputeTargetBytes(const TRefCountPtr<IPooledRenderTarget>& Target)
+	{
+		return Target.IsValid() ? int64(Target->ComputeMemorySize()) : 0;
+	}
+
+	static const TCHAR* LexBudgetTier(uint8 Tier)
+	{
+		switch (Tier)
+		{
+		case 0: return TEXT("Full");
+		case 1: return TEXT("NoFarField");
+		case 2: return TEXT("ReducedFormats");
+		case 3: return TEXT("NoPresentFallback");
+		default: return TEXT("Refused");
+		}
+	}
 }
 
 FAsyncReprojectionFrameCache& FAsyncReprojectionFrameCache::Get()
@@ -49,61 +232,144 @@ FAsyncReprojectionFrameCache& FAsyncReprojectionFrameCache::Get()
 	return Instance;
 }
 
+bool FAsyncReprojectionFrameCache::ShouldCaptureAtDisplayResolution(const FAsyncReprojectionCVarState& CVarState)
+{
+	// The EndOfPostProcess warp writes into the view family output, so only the PostRenderViewFamily copy is unwarped.
+	return CVarState.bFrameCacheCaptureAtDisplayResolution && CVarState.WarpPoint == EAsyncReprojectionWarpPoint::PostRenderViewFamily;
+}
+
 void FAsyncReprojectionFrameCache::Update_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessMaterialInputs& Inputs)
 {
 	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
 	const bool bAsyncPipelineEnabled = CVarState.bAsyncPresent || CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
-	if (!bAsyncPipelineEnabled)
+	if ((!bAsyncPipelineEnabled && !CVarState.bHitchMask) || ShouldCaptureAtDisplayResolution(CVarState))
 	{
 		return;
 	}
 
-	if (!Inputs.SceneTextures.SceneTextures)
+	FScreenPassTexture SceneColor = Inputs.ReturnUntouchedSceneColorForPostProcessing(GraphBuilder);
+	if (!SceneColor.IsValid())
 	{
-		if ((GFrameCounterRenderThread - AsyncReprojectionFrameCachePrivate::LastMissingSceneTexturesWarnFrame) >= AsyncReprojectionFrameCachePrivate::VerboseLogFrameInterval)
+		if ((GFrameCounterRenderThread - AsyncReprojectionFrameCachePrivate::LastInvalidSceneColorWarnFrame) >= AsyncReprojectionFrameCachePrivate::VerboseLogFrameInterval)
 		{
-			UE_LOG(LogAsyncReprojection, Warning, TEXT("FrameCache update skipped: SceneTextures uniform buffer is unavailable."));
-			AsyncReprojectionFrameCachePrivate::LastMissingSceneTexturesWarnFrame = GFrameCounterRenderThread;
+			UE_LOG(LogAsyncReprojection, Warning, TEXT("FrameCache update skipped: SceneColor is invalid."));
+			AsyncReprojectionFrameCachePrivate::LastInvalidSceneColorWarnFrame = GFrameCounterRenderThread;
 		}
 		return;
 	}
 
-	const int32 PlayerIndex = View.PlayerIndex;
+	// SceneColor carries its own view rect: the dynamic resolution rect before the upscaler, the output-sized one after it.
+	const FIntRect CachedViewRect = SceneColor.ViewRect.IsEmpty() ? View.ViewRect : SceneColor.ViewRect;
+	const FIntRect OutputRect = View.UnscaledViewRect.IsEmpty()
+		? FIntRect(FIntPoint::ZeroValue, SceneColor.Texture->Desc.Extent)
+		: View.UnscaledViewRect;
 
-	FScreenPassTexture SceneColor = Inputs.ReturnUntouchedSceneColorForPostProcessing(GraphBuilder);
-	if (!SceneColor.IsValid())
+	Capture_RenderThread(GraphBuilder, View, SceneColor.Texture, CachedViewRect, OutputRect, Inputs.SceneTextures.SceneTextures, false, CVarState);
+}
+
+void FAsyncReprojectionFrameCache::UpdateAtDisplayResolution_RenderThread(
+	FRDGBuilder& GraphBuilder,
+	const FSceneView& View,
+	FRDGTextureRef ViewFamilyTexture,
+	TRDGUniformBufferRef<FSceneTextureUniformParameters> SceneTextures)
+{
+	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
+	const bool bAsyncPipelineEnabled = CVarState.bAsyncPresent || CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
+	if ((!bAsyncPipelineEnabled && !CVarState.bHitchMask) || !ShouldCaptureAtDisplayResolution(CVarState))
+	{
+		return;
+	}
+
+	if (ViewFamilyTexture == nullptr)
 	{
 		if ((GFrameCounterRenderThread - AsyncReprojectionFrameCachePrivate::LastInvalidSceneColorWarnFrame) >= AsyncReprojectionFrameCachePrivate::VerboseLogFrameInterval)
 		{
-			UE_LOG(LogAsyncReprojection, Warning, TEXT("FrameCache update skipped: SceneColor is invalid."));
+			UE_LOG(LogAsyncReprojection, Warning, TEXT("FrameCache display-resolution update skipped: view family texture is unavailable."));
 			AsyncReprojectionFrameCachePrivate::LastInvalidSceneColorWarnFrame = GFrameCounterRenderThread;
 		}
 		return;
 	}
 
-	const FIntPoint Extent = SceneColor.Texture->Desc.Extent;
-	if (Extent.X <= 0 || Extent.Y <= 0)
+	const FIntRect CachedViewRect = View.UnconstrainedViewRect.IsEmpty()
+		? FIntRect(FIntPoint::ZeroValue, ViewFamilyTexture->Desc.Extent)
+		: View.UnconstrainedViewRect;
+
+	Capture_RenderThread(GraphBuilder, View, ViewFamilyTexture, CachedViewRect, CachedViewRect, SceneTextures, true, CVarState);
+}
+
+void FAsyncReprojectionFrameCache::Capture_RenderThread(
+	FRDGBuilder& GraphBuilder,
+	const FSceneView& View,
+	FRDGTextureRef SourceColor,
+	const FIntRect& CachedViewRect,
+	const FIntRect& OutputRect,
+	TRDGUniformBufferRef<FSceneTextureUniformParameters> SceneTextures,
+	bool bDisplayResolution,
+	const FAsyncReprojectionCVarState& CVarState)
+{
+	// A foreground-only view holds no world; the cache keeps the last full frame.
+	if (FAsyncReprojectionForeground::Get().IsForegroundView_RenderThread(View))
+	{
+		return;
+	}
+
+	if (!SceneTextures)
 	{
-		UE_LOG(LogAsyncReprojection, Fatal, TEXT("FrameCache received invalid SceneColor extent (%d x %d)."), Extent.X, Extent.Y);
+		if ((GFrameCounterRenderThread - AsyncReprojectionFrameCachePrivate::LastMissingSceneTexturesWarnFrame) >= AsyncReprojectionFrameCachePrivate::VerboseLogFrameInterval)
+		{
+			UE_LOG(LogAsyncReprojection, Warning, TEXT("FrameCache update skipped: SceneTextures uniform buffer is unavailable."));
+			AsyncReprojectionFrameCachePrivate::LastMissingSceneTexturesWarnFrame = GFrameCounterRenderThread;
+		}
 		return;
 	}
 
-	const EPixelFormat ColorFormat = SceneColor.Texture->Desc.Format;
+	const int32 PlayerIndex = FAsyncReprojectionStereo::GetViewSlotIndex(View);
+	FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+	if (Slot == nullptr)
+	{
+		// A new local player renders once before the tracker registers it at end of frame.
+		if ((GFrameCounterRenderThread - AsyncReprojectionFrameCachePrivate::LastUnregisteredPlayerWarnFrame) >= AsyncReprojectionFrameCachePrivate::VerboseLogFrameInterval)
+		{
+			UE_LOG(LogAsyncReprojection, Verbose, TEXT("FrameCache update skipped: PlayerIndex=%d is not registered yet."), PlayerIndex);
+			AsyncReprojectionFrameCachePrivate::LastUnregisteredPlayerWarnFrame = GFrameCounterRenderThread;
+		}
+		return;
+	}
 
-	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
-	EnsureTargets_RenderThread(RHICmdList, PlayerIndex, Extent, ColorFormat);
+	const FIntPoint SourceExtent = SourceColor->Desc.Extent;
+	if (SourceExtent.X <= 0 || SourceExtent.Y <= 0)
+	{
+		UE_LOG(LogAsyncReprojection, Fatal, TEXT("FrameCache received invalid SceneColor extent (%d x %d)."), SourceExtent.X, SourceExtent.Y);
+		return;
+	}
 
-	TRefCountPtr<IPooledRenderTarget> ColorTarget;
-	TRefCountPtr<IPooledRenderTarget> DepthTarget;
+	const FIntRect CaptureRect = FIntRect::Intersect(CachedViewRect, FIntRect(FIntPoint::ZeroValue, SourceExtent));
+	if (CaptureRect.IsEmpty())
 	{
-		FRWScopeLock Lock(CacheLock, SLT_ReadOnly);
-		if (const FCachedTargets* Existing = CacheByPlayer.Find(PlayerIndex))
+		if ((GFrameCounterRenderThread - AsyncReprojectionFrameCachePrivate::LastInvalidSceneColorWarnFrame) >= AsyncReprojectionFrameCachePrivate::VerboseLogFrameInterval)
 		{
-			ColorTarget = Existing->Color;
-			DepthTarget = Existing->DepthDeviceZ;
+			UE_LOG(LogAsyncReprojection, Warning, TEXT("FrameCache update skipped: view rect is outside SceneColor for PlayerIndex=%d."), PlayerIndex);
+			AsyncReprojectionFrameCachePrivate::LastInvalidSceneColorWarnFrame = GFrameCounterRenderThread;
 		}
+		return;
+	}
+
+	const EPixelFormat ColorFormat = AsyncReprojectionFrameCachePrivate::ResolveCachedColorFormat(SourceColor->Desc.Format, CVarState.bFrameCacheReducedColorFormat);
+
+	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
+	// SceneColor is allocated for the upper bound of dynamic resolution, so sizing the cache by it (rather than by the
+	// view rect) settles the targets on the first capture.
+	// Stereo eyes keep no far-field map; see UpdateFarField_RenderThread.
+	const bool bFarField = CVarState.bFarField && !FAsyncReprojectionStereo::IsStereoEyeView(View);
+	if (!EnsureTargets_RenderThread(RHICmdList, PlayerIndex, SourceExtent, ColorFormat, bFarField, CVarState))
+	{
+		return;
 	}
 
+	const TRefCountPtr<IPooledRenderTarget> ColorTarget = Slot->Targets.Color;
+	const TRefCountPtr<IPooledRenderTarget> DepthTarget = Slot->Targets.DepthDeviceZ;
+	const TRefCountPtr<IPooledRenderTarget> ObjectMotionTarget = Slot->Targets.ObjectMotion;
+
 	if (!ColorTarget.IsValid() || !DepthTarget.IsValid())
 	{
 		if ((GFrameCounterRenderThread - AsyncReprojectionFrameCachePrivate::LastMissingTargetsErrorFrame) >= AsyncReprojectionFrameCachePrivate::VerboseLogFrameInterval)
@@ -116,115 +382,278 @@ void FAsyncReprojectionFrameCache::Update_RenderThread(FRDGBuilder& GraphBuilder
 
 	FRDGTextureRef ColorExternal = GraphBuilder.RegisterExternalTexture(ColorTarget, TEXT("AsyncReprojection.CachedColor"));
 	FRDGTextureRef DepthExternal = GraphBuilder.RegisterExternalTexture(DepthTarget, TEXT("AsyncReprojection.CachedDepthDeviceZ"));
+	FRDGTextureRef ObjectMotionExternal = ObjectMotionTarget.IsValid()
+		? GraphBuilder.RegisterExternalTexture(ObjectMotionTarget, TEXT("AsyncReprojection.CachedObjectMotion"))
+		: nullptr;
+
+	const bool bCaptureOnAsyncCompute = AsyncReprojectionFrameCachePrivate::ShouldCaptureOnAsyncCompute(CVarState);
+	const FIntPoint BufferExtent = ColorTarget->GetDesc().Extent;
 
-	AddCopyTexturePass(GraphBuilder, SceneColor.Texture, ColorExternal);
+	// Only the active rect is captured; groups start on a tile boundary of the cached targets.
+	const FIntPoint CaptureTileOrigin = FIntPoint(
+		CaptureRect.Min.X / AsyncReprojectionFrameCachePrivate::CaptureTileSize,
+		CaptureRect.Min.Y / AsyncReprojectionFrameCachePrivate::CaptureTileSize);
+	const FIntPoint DispatchExtent = CaptureRect.Max - CaptureTileOrigin * AsyncReprojectionFrameCachePrivate::CaptureTileSize;
 
 	{
-		FRDGTextureUAVRef DepthUAV = GraphBuilder.CreateUAV(FRDGTextureUAVDesc(DepthExternal, 0));
+		RDG_GPU_STAT_SCOPE(GraphBuilder, AsyncReprojectionCapture);
 
-		AsyncReprojectionFrameCachePrivate::FCacheDepthDeviceZCS::FParameters* PassParameters =
-			GraphBuilder.AllocParameters<AsyncReprojectionFrameCachePrivate::FCacheDepthDeviceZCS::FParameters>();
+		AsyncReprojectionFrameCachePrivate::FCaptureFrameCS::FParameters* PassParameters =
+			GraphBuilder.AllocParameters<AsyncReprojectionFrameCachePrivate::FCaptureFrameCS::FParameters>();
 
 		PassParameters->View.View = View.ViewUniformBuffer;
 		PassParameters->View.InstancedView = View.GetInstancedViewUniformBuffer();
-		PassParameters->SceneTexturesStruct = Inputs.SceneTextures.SceneTextures;
+		PassParameters->SceneTexturesStruct = SceneTextures;
+		PassParameters->SceneColorTexture = SourceColor;
+		PassParameters->DepthPixelScaleBias = AsyncReprojectionFrameCachePrivate::ComputeDepthPixelScaleBias(View, CachedViewRect);
+		PassParameters->CaptureRectMinMax = FIntVector4(CaptureRect.Min.X, CaptureRect.Min.Y, CaptureRect.Max.X, CaptureRect.Max.Y);
+		PassParameters->CaptureTileOrigin = CaptureTileOrigin;
+		PassParameters->OutColor = GraphBuilder.CreateUAV(FRDGTextureUAVDesc(ColorExternal, 0));
+		PassParameters->OutDeviceZ = GraphBuilder.CreateUAV(FRDGTextureUAVDesc(DepthExternal, 0));
+		if (ObjectMotionExternal)
+		{
+			PassParameters->OutObjectMotion = GraphBuilder.CreateUAV(FRDGTextureUAVDesc(ObjectMotionExternal, 0));
+			PassParameters->MotionToCachedPixelsPerSecond = AsyncReprojectionFrameCachePrivate::ComputeMotionToCachedPixelsPerSecond(View, CachedViewRect);
+		}
 
-		PassParameters->BufferSizeAndInvSize = FVector4f(float(Extent.X), float(Extent.Y), 1.0f / float(Extent.X), 1.0f / float(Extent.Y));
-		PassParameters->OutDeviceZ = DepthUAV;
+		AsyncReprojectionFrameCachePrivate::FCaptureFrameCS::FPermutationDomain PermutationVector;
+		PermutationVector.Set<AsyncReprojectionFrameCachePrivate::FCaptureObjectMotion>(ObjectMotionExternal != nullptr);
 
-		TShaderMapRef<AsyncReprojectionFrameCachePrivate::FCacheDepthDeviceZCS> ComputeShader(GetGlobalShaderMap(View.GetFeatureLevel()));
+		TShaderMapRef<AsyncReprojectionFrameCachePrivate::FCaptureFrameCS> ComputeShader(GetGlobalShaderMap(View.GetFeatureLevel()), PermutationVector);
 
 		FComputeShaderUtils::AddPass(
 			GraphBuilder,
-			RDG_EVENT_NAME("AsyncReprojection CacheDepthDeviceZ"),
+			RDG_EVENT_NAME(
+				"AsyncReprojection CaptureFrame %dx%d (%s, %s%s)",
+				CaptureRect.Width(),
+				CaptureRect.Height(),
+				bDisplayResolution ? TEXT("Display") : TEXT("Internal"),
+				bCaptureOnAsyncCompute ? TEXT("AsyncCompute") : TEXT("Graphics"),
+				ObjectMotionExternal ? TEXT(", ObjectMotion") : TEXT("")),
+			bCaptureOnAsyncCompute ? ERDGPassFlags::AsyncCompute : ERDGPassFlags::Compute,
 			ComputeShader,
 			PassParameters,
-			FIntVector(
-				FMath::DivideAndRoundUp(Extent.X, 8),
-				FMath::DivideAndRoundUp(Extent.Y, 8),
-				1));
-	}
-
-		FAsyncReprojectionCachedFrameConstants Constants;
-		Constants.bValid = true;
-		Constants.ViewRect = View.UnscaledViewRect.IsEmpty() ? FIntRect(FIntPoint::ZeroValue, Extent) : View.UnscaledViewRect;
-		Constants.BufferExtent = Extent;
-		Constants.RenderedRotation = View.ViewRotation.Quaternion();
-		Constants.RenderedLocation = View.ViewLocation;
+			FComputeShaderUtils::GetGroupCount(DispatchExtent, AsyncReprojectionFrameCachePrivate::CaptureTileSize));
+	}
+
+	FAsyncReprojectionCachedFrameConstants Constants;
+	Constants.bValid = true;
+	Constants.ViewRect = CaptureRect;
+	Constants.BufferExtent = BufferExtent;
+	Constants.OutputRect = OutputRect;
+	Constants.RenderedRotation = View.ViewRotation.Quaternion();
+	Constants.RenderedLocation = View.ViewLocation;
 	Constants.PreViewTranslation = View.ViewMatrices.GetPreViewTranslation();
 	Constants.ViewToClip = FMatrix44f(View.ViewMatrices.GetProjectionMatrix());
 	Constants.ClipToView = FMatrix44f(View.ViewMatrices.GetInvProjectionMatrix());
-	Constants.RenderedSVPositionToTranslatedWorld = ComputeSVPositionToTranslatedWorld(View, Constants.ViewRect, Extent);
+	Constants.OverscanScale = FAsyncReprojectionOverscan::Get().GetScale_RenderThread(PlayerIndex);
+	Constants.RenderedSVPositionToTranslatedWorld = ComputeSVPositionToTranslatedWorld(View, Constants.ViewRect, BufferExtent);
 	Constants.FeatureLevel = View.GetFeatureLevel();
+	Constants.bStereoEye = FAsyncReprojectionStereo::IsStereoEyeView(View);
+	if (Constants.bStereoEye)
+	{
+		const FAsyncReprojectionHeadPose RenderedHead = FAsyncReprojectionStereo::Get().GetRenderedHeadPose_RenderThread();
+		Constants.bRenderedHeadValid = RenderedHead.bIsValid;
+		Constants.RenderedHeadRotation = RenderedHead.Rotation;
+		Constants.RenderedHeadLocation = RenderedHead.Location;
+	}
+	Constants.bCapturedAtDisplayResolution = bDisplayResolution;
 	Constants.RenderThreadFrameCounter = GFrameCounterRenderThread;
 	Constants.CaptureTimeSeconds = FPlatformTime::Seconds();
 
-		{
-			FRWScopeLock Lock(CacheLock, SLT_Write);
-			FCachedTargets& Slot = CacheByPlayer.FindOrAdd(PlayerIndex);
-			Slot.Constants = Constants;
-		}
+	UpdateFarField_RenderThread(
+		GraphBuilder,
+		PlayerIndex,
+		Constants,
+		ColorExternal,
+		DepthExternal,
+		bCaptureOnAsyncCompute ? ERDGPassFlags::AsyncCompute : ERDGPassFlags::Compute,
+		CVarState);
 
-	if (PlayerIndex >= 0 && PlayerIndex < MaxCachedPlayers)
-	{
-		LastValidCaptureFrameCounter[PlayerIndex].store(GFrameCounterRenderThread, std::memory_order_relaxed);
-		LastCaptureTimeSeconds[PlayerIndex].store(Constants.CaptureTimeSeconds, std::memory_order_relaxed);
-	}
+	Slot->Targets.Constants = Constants;
+	Slot->Capture.Publish(Constants, Constants.RenderThreadFrameCounter, Constants.CaptureTimeSeconds);
+	Slot->LastUseTimeSeconds.store(Constants.CaptureTimeSeconds, std::memory_order_relaxed);
+
+	ReportTraffic_RenderThread(PlayerIndex, View, CaptureRect.Size(), SourceColor->Desc.Format, bDisplayResolution);
 
 	if ((GFrameCounterRenderThread - AsyncReprojectionFrameCachePrivate::LastVerboseUpdateFrame) >= AsyncReprojectionFrameCachePrivate::VerboseLogFrameInterval)
 	{
 		UE_LOG(
 			LogAsyncReprojection,
 			Verbose,
-			TEXT("FrameCache updated: PlayerIndex=%d Extent=%dx%d Format=%d Frame=%llu"),
+			TEXT("FrameCache updated: PlayerIndex=%d Rect=%dx%d+%d+%d Extent=%dx%d DisplayResolution=%d Format=%d AsyncCompute=%d Frame=%llu"),
 			PlayerIndex,
-			Extent.X,
-			Extent.Y,
+			CaptureRect.Width(),
+			CaptureRect.Height(),
+			CaptureRect.Min.X,
+			CaptureRect.Min.Y,
+			BufferExtent.X,
+			BufferExtent.Y,
+			bDisplayResolution ? 1 : 0,
 			int32(ColorFormat),
+			bCaptureOnAsyncCompute ? 1 : 0,
 			GFrameCounterRenderThread);
 		AsyncReprojectionFrameCachePrivate::LastVerboseUpdateFrame = GFrameCounterRenderThread;
 	}
 }
 
-bool FAsyncReprojectionFrameCache::GetCachedFrame_RenderThread(int32 PlayerIndex, TRefCountPtr<IPooledRenderTarget>& OutColor, TRefCountPtr<IPooledRenderTarget>& OutDepthDeviceZ, FAsyncReprojectionCachedFrameConstants& OutConstants) const
+void FAsyncReprojectionFrameCache::UpdateFarField_RenderThread(
+	FRDGBuilder& GraphBuilder,
+	int32 PlayerIndex,
+	const FAsyncReprojectionCachedFrameConstants& Constants,
+	FRDGTextureRef CachedColor,
+	FRDGTextureRef CachedDepthDeviceZ,
+	ERDGPassFlags PassFlags,
+	const FAsyncReprojectionCVarState& CVarState)
 {
-	FRWScopeLock Lock(CacheLock, SLT_ReadOnly);
-	const FCachedTargets* Cached = CacheByPlayer.Find(PlayerIndex);
-	if (Cached == nullptr || !Cached->Constants.bValid || !Cached->Color.IsValid() || !Cached->DepthDeviceZ.IsValid())
+	FCachedTargets& Targets = PlayerSlots.Find(PlayerIndex)->Targets;
+
+	// Stereo eyes are warped by head motion the far field would have to follow per eye; they keep the plain border policy.
+	if (!CVarState.bFarField || Constants.bStereoEye || Targets.BudgetTier >= BudgetTierNoFarField)
+	{
+		if (Targets.FarField.IsValid())
+		{
+			Targets.FarField.SafeRelease();
+			Targets.bFarFieldValid = false;
+			UpdateMemoryStats_RenderThread();
+		}
+		return;
+	}
+
+	const int32 Size = AsyncReprojectionFrameCachePrivate::GetFarFieldSize(CVarState);
+	const float MinDistance = FMath::Max(0.0f, CVarState.FarFieldMinDistanceCm);
+
+	bool bClear = !Targets.bFarFieldValid;
+	if (!Targets.FarField.IsValid() || Targets.FarField->GetDesc().Extent != FIntPoint(Size, Size))
+	{
+		FPooledRenderTargetDesc FarFieldDesc = FPooledRenderTargetDesc::Create2DDesc(
+			FIntPoint(Size, Size),
+			AsyncReprojectionFrameCachePrivate::FarFieldFormat,
+			FClearValueBinding::Transparent,
+			TexCreate_None,
+			TexCreate_ShaderResource | TexCreate_UAV,
+			false);
+
+		GRenderTargetPool.FindFreeElement(FRHICommandListExecutor::GetImmediateCommandList(), FarFieldDesc, Targets.FarField, TEXT("AsyncReprojection.FarField"));
+		UpdateMemoryStats_RenderThread();
+		bClear = true;
+	}
+
+	// Content at MinDistance shifts by atan(Drift / MinDistance) once the camera moves, so the map restarts before that shows.
+	const double MaxDrift = double(MinDistance) * FMath::Tan(FMath::DegreesToRadians(AsyncReprojectionFrameCachePrivate::FarFieldMaxParallaxDegrees));
+	if (!bClear && FVector::Dist(Targets.FarFieldOrigin, Constants.RenderedLocation) > MaxDrift)
+	{
+		if ((GFrameCounterRenderThread - AsyncReprojectionFrameCachePrivate::LastFarFieldRestartLogFrame) >= AsyncReprojectionFrameCachePrivate::VerboseLogFrameInterval)
+		{
+			UE_LOG(LogAsyncReprojection, Verbose, TEXT("FrameCache far field for PlayerIndex=%d restarts: camera moved more than %.0fcm."), PlayerIndex, MaxDrift);
+			AsyncReprojectionFrameCachePrivate::LastFarFieldRestartLogFrame = GFrameCounterRenderThread;
+		}
+		bClear = true;
+	}
+
+	FRDGTextureRef FarFieldExternal = GraphBuilder.RegisterExternalTexture(Targets.FarField, TEXT("AsyncReprojection.FarField"));
+	if (bClear)
+	{
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(FarFieldExternal), FLinearColor::Transparent);
+		Targets.FarFieldOrigin = Constants.RenderedLocation;
+	}
+
+	AsyncReprojectionFrameCachePrivate::FUpdateFarFieldCS::FParameters* PassParameters =
+		GraphBuilder.AllocParameters<AsyncReprojectionFrameCachePrivate::FUpdateFarFieldCS::FParameters>();
+	PassParameters->CachedColorTexture = CachedColor;
+	PassParameters->CachedDeviceZTexture = CachedDepthDeviceZ;
+	PassParameters->RenderedSVPositionToTranslatedWorld = Constants.RenderedSVPositionToTranslatedWorld;
+	PassParameters->TranslatedWorldToRenderedSVPosition = Constants.RenderedSVPositionToTranslatedWorld.Inverse();
+	PassParameters->CaptureRectMinMax = FIntVector4(Constants.ViewRect.Min.X, Constants.ViewRect.Min.Y, Constants.ViewRect.Max.X, Constants.ViewRect.Max.Y);
+	PassParameters->MinDistance = MinDistance;
+	PassParameters->FarFieldSize = uint32(Size);
+	PassParameters->RWFarField = GraphBuilder.CreateUAV(FarFieldExternal);
+
+	TShaderMapRef<AsyncReprojectionFrameCachePrivate::FUpdateFarFieldCS> ComputeShader(GetGlobalShaderMap(Constants.FeatureLevel));
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("AsyncReprojection UpdateFarField %dx%d%s", Size, Size, bClear ? TEXT(" (clear)") : TEXT("")),
+		PassFlags,
+		ComputeShader,
+		PassParameters,
+		FComputeShaderUtils::GetGroupCount(FIntPoint(Size, Size), AsyncReprojectionFrameCachePrivate::FarFieldTileSize));
+
+	Targets.bFarFieldValid = true;
+}
+
+bool FAsyncReprojectionFrameCache::AcquireCachedFrame_RenderThread(int32 PlayerIndex, TRefCountPtr<IPooledRenderTarget>& OutColor, TRefCountPtr<IPooledRenderTarget>& OutDepthDeviceZ, FAsyncReprojectionCachedFrameConstants& OutConstants)
+{
+	FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+	if (Slot == nullptr)
+	{
+		return false;
+	}
+
+	const FCachedTargets& Cached = Slot->Targets;
+	if (!Cached.Constants.bValid || !Cached.Color.IsValid() || !Cached.DepthDeviceZ.IsValid())
 	{
 		return false;
 	}
 
-	OutColor = Cached->Color;
-	OutDepthDeviceZ = Cached->DepthDeviceZ;
-	OutConstants = Cached->Constants;
+	OutColor = Cached.Color;
+	OutDepthDeviceZ = Cached.DepthDeviceZ;
+	OutConstants = Cached.Constants;
+
+	Slot->LastUseTimeSeconds.store(FPlatformTime::Seconds(), std::memory_order_relaxed);
+	return true;
+}
+
+bool FAsyncReprojectionFrameCache::GetCachedObjectMotion_RenderThread(int32 PlayerIndex, TRefCountPtr<IPooledRenderTarget>& OutObjectMotion) const
+{
+	const FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+	if (Slot == nullptr || !Slot->Targets.Constants.bValid || !Slot->Targets.ObjectMotion.IsValid())
+	{
+		return false;
+	}
+
+	OutObjectMotion = Slot->Targets.ObjectMotion;
+	return true;
+}
+
+bool FAsyncReprojectionFrameCache::GetCachedFarField_RenderThread(int32 PlayerIndex, TRefCountPtr<IPooledRenderTarget>& OutFarField) const
+{
+	const FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+	if (Slot == nullptr || !Slot->Targets.bFarFieldValid || !Slot->Targets.FarField.IsValid())
+	{
+		return false;
+	}
+
+	OutFarField = Slot->Targets.FarField;
 	return true;
 }
 
 bool FAsyncReprojectionFrameCache::HasCachedFrame_AnyThread(int32 PlayerIndex) const
 {
-	if (PlayerIndex < 0 || PlayerIndex >= MaxCachedPlayers)
+	const FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+	if (Slot == nullptr)
 	{
 		return false;
 	}
 
-	return LastValidCaptureFrameCounter[PlayerIndex].load(std::memory_order_relaxed) != 0;
+	return Slot->Capture.ReadTags().FrameCounter != 0;
 }
 
 bool FAsyncReprojectionFrameCache::HasUsableCachedFrame_AnyThread(int32 PlayerIndex, double NowSeconds, int32 MaxCacheAgeMs) const
 {
-	if (PlayerIndex < 0 || PlayerIndex >= MaxCachedPlayers)
+	const FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+	if (Slot == nullptr)
 	{
 		return false;
 	}
 
-	const uint64 CaptureFrameCounter = LastValidCaptureFrameCounter[PlayerIndex].load(std::memory_order_relaxed);
-	if (CaptureFrameCounter == 0)
+	// Frame and time come from the same capture, so a capture landing between the checks cannot mix them.
+	const FAsyncReprojectionSnapshotTags Capture = Slot->Capture.ReadTags();
+	if (Capture.FrameCounter == 0)
 	{
 		return false;
 	}
 
-	const double CaptureTimeSeconds = LastCaptureTimeSeconds[PlayerIndex].load(std::memory_order_relaxed);
+	const double CaptureTimeSeconds = Capture.TimeSeconds;
 	if (CaptureTimeSeconds <= 0.0)
 	{
 		return false;
@@ -242,53 +671,167 @@ bool FAsyncReprojectionFrameCache::HasUsableCachedFrame_AnyThread(int32 PlayerIn
 
 double FAsyncReprojectionFrameCache::GetLastCaptureTimeSeconds_AnyThread(int32 PlayerIndex) const
 {
-	if (PlayerIndex < 0 || PlayerIndex >= MaxCachedPlayers)
+	const FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+	if (Slot == nullptr)
 	{
 		return 0.0;
 	}
 
-	return LastCaptureTimeSeconds[PlayerIndex].load(std::memory_order_relaxed);
+	return Slot->Capture.ReadTags().TimeSeconds;
+}
+
+uint8 FAsyncReprojectionFrameCache::SelectBudgetTier_RenderThread(int32 PlayerIndex, const FIntPoint& Extent, EPixelFormat ColorFormat, EPixelFormat ReducedColorFormat, EPixelFormat ReducedDepthFormat, bool bObjectMotion, int32 FarFieldSize, int32 BudgetMB) const
+{
+	if (BudgetMB <= 0)
+	{
+		return BudgetTierFull;
+	}
+
+	int64 OtherPlayersBytes = 0;
+	for (int32 OtherIndex = 0; OtherIndex < PlayerSlots.Num(); OtherIndex++)
+	{
+		if (OtherIndex != PlayerIndex)
+		{
+			OtherPlayersBytes += ComputeSlotBytes(PlayerSlots.Find(OtherIndex)->Targets);
+		}
+	}
+
+	const int64 AvailableBytes = int64(BudgetMB) * 1024 * 1024 - OtherPlayersBytes;
+	// The back buffer format is not known at capture time; budget the present fallback as an 8-bit target of the same extent.
+	const int64 FallbackBytes = int64(CalculateImageBytes(Extent.X, Extent.Y, 0, PF_B8G8R8A8));
+	const int64 FullBytes = AsyncReprojectionFrameCachePrivate::EstimateCaptureBytes(Extent, ColorFormat, PF_R32_FLOAT, bObjectMotion);
+	const int64 ReducedBytes = AsyncReprojectionFrameCachePrivate::EstimateCaptureBytes(Extent, ReducedColorFormat, ReducedDepthFormat, bObjectMotion);
+	const int64 FarFieldBytes = AsyncReprojectionFrameCachePrivate::EstimateFarFieldBytes(FarFieldSize);
+
+	if (FullBytes + FallbackBytes + FarFieldBytes <= AvailableBytes)
+	{
+		return BudgetTierFull;
+	}
+	if (FullBytes + FallbackBytes <= AvailableBytes)
+	{
+		return BudgetTierNoFarField;
+	}
+	if (ReducedBytes + FallbackBytes <= AvailableBytes)
+	{
+		return BudgetTierReducedFormats;
+	}
+	if (ReducedBytes <= AvailableBytes)
+	{
+		return BudgetTierNoPresentFallback;
+	}
+	return BudgetTierRefused;
 }
 
-void FAsyncReprojectionFrameCache::EnsureTargets_RenderThread(FRHICommandListImmediate& RHICmdList, int32 PlayerIndex, const FIntPoint& Extent, EPixelFormat ColorFormat)
+bool FAsyncReprojectionFrameCache::EnsureTargets_RenderThread(FRHICommandListImmediate& RHICmdList, int32 PlayerIndex, const FIntPoint& RequiredExtent, EPixelFormat ColorFormat, bool bFarField, const FAsyncReprojectionCVarState& CVarState)
 {
+	FPlayerSlot* PlayerSlot = PlayerSlots.Find(PlayerIndex);
+	check(PlayerSlot != nullptr);
+	FCachedTargets& Slot = PlayerSlot->Targets;
+
+	// Targets only grow: a smaller frame is captured into a sub-rect, so dynamic resolution never reallocates them.
+	const bool bHasTargets = Slot.Color.IsValid() && Slot.DepthDeviceZ.IsValid();
+	const FIntPoint ExistingExtent = bHasTargets ? Slot.Color->GetDesc().Extent : FIntPoint::ZeroValue;
+	const FIntPoint Extent = bHasTargets ? ExistingExtent.ComponentMax(RequiredExtent) : RequiredExtent;
+
+	const EPixelFormat ReducedColorFormat = AsyncReprojectionFrameCachePrivate::ResolveReducedFormat(ColorFormat, PF_FloatR11G11B10);
+	const EPixelFormat ReducedDepthFormat = AsyncReprojectionFrameCachePrivate::ResolveReducedFormat(PF_R32_FLOAT, PF_R16F);
+	const bool bObjectMotion = CVarState.bAsyncPresentObjectMotion;
+	const int32 FarFieldSize = bFarField ? AsyncReprojectionFrameCachePrivate::GetFarFieldSize(CVarState) : 0;
+	const uint8 BudgetTier = SelectBudgetTier_RenderThread(PlayerIndex, Extent, ColorFormat, ReducedColorFormat, ReducedDepthFormat, bObjectMotion, FarFieldSize, CVarState.FrameCacheBudgetMB);
+
+	if (BudgetTier == BudgetTierRefused)
+	{
+		if ((GFrameCounterRenderThread - AsyncReprojectionFrameCachePrivate::LastBudgetWarnFrame) >= AsyncReprojectionFrameCachePrivate::VerboseLogFrameInterval)
+		{
+			UE_LOG(
+				LogAsyncReprojection,
+				Warning,
+				TEXT("FrameCache capture refused: PlayerIndex=%d Extent=%dx%d does not fit r.AsyncReprojection.FrameCache.BudgetMB=%d."),
+				PlayerIndex,
+				Extent.X,
+				Extent.Y,
+				CVarState.FrameCacheBudgetMB);
+			AsyncReprojectionFrameCachePrivate::LastBudgetWarnFrame = GFrameCounterRenderThread;
+		}
+
+		ReleasePlayerTargets_RenderThread(PlayerIndex);
+		return false;
+	}
+
+	const bool bReducedFormats = BudgetTier >= BudgetTierReducedFormats;
+	const EPixelFormat TargetColorFormat = bReducedFormats ? ReducedColorFormat : ColorFormat;
+	const EPixelFormat TargetDepthFormat = bReducedFormats ? ReducedDepthFormat : PF_R32_FLOAT;
+
+	const bool bTierChanged = Slot.BudgetTier != BudgetTier;
 	bool bNeedsAlloc = false;
+	if (!bHasTargets)
+	{
+		bNeedsAlloc = true;
+	}
+	else
+	{
+		bNeedsAlloc = (ExistingExtent != Extent)
+			|| (Slot.Color->GetDesc().Format != TargetColorFormat)
+			|| (Slot.DepthDeviceZ->GetDesc().Format != TargetDepthFormat)
+			|| (Slot.ObjectMotion.IsValid() != bObjectMotion);
+	}
+
+	if (bTierChanged)
 	{
-		FRWScopeLock Lock(CacheLock, SLT_ReadOnly);
-		if (const FCachedTargets* Existing = CacheByPlayer.Find(PlayerIndex))
+		UE_LOG(
+			LogAsyncReprojection,
+			Log,
+			TEXT("FrameCache budget tier for PlayerIndex=%d is now %s (BudgetMB=%d)."),
+			PlayerIndex,
+			AsyncReprojectionFrameCachePrivate::LexBudgetTier(BudgetTier),
+			CVarState.FrameCacheBudgetMB);
+
+		Slot.BudgetTier = BudgetTier;
+		if (BudgetTier >= BudgetTierNoFarField)
 		{
-			if (!Existing->Color.IsValid() || !Existing->DepthDeviceZ.IsValid())
-			{
-				bNeedsAlloc = true;
-			}
-			else
-			{
-				const FIntPoint ExistingExtent = Existing->Color->GetDesc().Extent;
-				bNeedsAlloc = (ExistingExtent != Extent) || (Existing->Color->GetDesc().Format != ColorFormat);
-			}
+			Slot.FarField.SafeRelease();
+			Slot.bFarFieldValid = false;
 		}
-		else
+		if (BudgetTier >= BudgetTierNoPresentFallback)
 		{
-			bNeedsAlloc = true;
+			Slot.PresentFallbackColor.SafeRelease();
+			Slot.bPresentFallbackValid = false;
 		}
 	}
 
 	if (!bNeedsAlloc)
 	{
-		return;
+		if (bTierChanged)
+		{
+			UpdateMemoryStats_RenderThread();
+		}
+		return true;
+	}
+
+	if (bHasTargets && ExistingExtent != Extent)
+	{
+		UE_LOG(
+			LogAsyncReprojection,
+			Log,
+			TEXT("FrameCache targets for PlayerIndex=%d grow from %dx%d to %dx%d."),
+			PlayerIndex,
+			ExistingExtent.X,
+			ExistingExtent.Y,
+			Extent.X,
+			Extent.Y);
 	}
 
 	FPooledRenderTargetDesc ColorDesc = FPooledRenderTargetDesc::Create2DDesc(
 		Extent,
-		ColorFormat,
+		TargetColorFormat,
 		FClearValueBinding::Transparent,
 		TexCreate_None,
-		TexCreate_ShaderResource | TexCreate_RenderTargetable,
+		TexCreate_ShaderResource | TexCreate_UAV | TexCreate_RenderTargetable,
 		false);
 
 	FPooledRenderTargetDesc DepthDesc = FPooledRenderTargetDesc::Create2DDesc(
 		Extent,
-		PF_R32_FLOAT,
+		TargetDepthFormat,
 		FClearValueBinding::Black,
 		TexCreate_None,
 		TexCreate_ShaderResource | TexCreate_UAV | TexCreate_RenderTargetable,
@@ -296,45 +839,59 @@ void FAsyncReprojectionFrameCache::EnsureTargets_RenderThread(FRHICommandListImm
 
 	TRefCountPtr<IPooledRenderTarget> NewColor;
 	TRefCountPtr<IPooledRenderTarget> NewDepth;
+	TRefCountPtr<IPooledRenderTarget> NewObjectMotion;
 	GRenderTargetPool.FindFreeElement(RHICmdList, ColorDesc, NewColor, TEXT("AsyncReprojection.CachedColor"));
 	GRenderTargetPool.FindFreeElement(RHICmdList, DepthDesc, NewDepth, TEXT("AsyncReprojection.CachedDepthDeviceZ"));
 
+	if (bObjectMotion)
 	{
-		FRWScopeLock Lock(CacheLock, SLT_Write);
-		FCachedTargets& Slot = CacheByPlayer.FindOrAdd(PlayerIndex);
-		Slot.Color = NewColor;
-		Slot.DepthDeviceZ = NewDepth;
-		Slot.Constants.bValid = false;
-	}
+		FPooledRenderTargetDesc ObjectMotionDesc = FPooledRenderTargetDesc::Create2DDesc(
+			Extent,
+			AsyncReprojectionFrameCachePrivate::ObjectMotionFormat,
+			FClearValueBinding::Black,
+			TexCreate_None,
+			TexCreate_ShaderResource | TexCreate_UAV,
+			false);
 
-	if (PlayerIndex >= 0 && PlayerIndex < MaxCachedPlayers)
-	{
-		LastValidCaptureFrameCounter[PlayerIndex].store(0, std::memory_order_relaxed);
-		LastCaptureTimeSeconds[PlayerIndex].store(0.0, std::memory_order_relaxed);
+		GRenderTargetPool.FindFreeElement(RHICmdList, ObjectMotionDesc, NewObjectMotion, TEXT("AsyncReprojection.CachedObjectMotion"));
 	}
+
+	Slot.Color = NewColor;
+	Slot.DepthDeviceZ = NewDepth;
+	Slot.ObjectMotion = NewObjectMotion;
+	Slot.BudgetTier = BudgetTier;
+	Slot.Constants.bValid = false;
+
+	PlayerSlot->Capture.Reset();
+
+	UpdateMemoryStats_RenderThread();
+	return true;
 }
 
 void FAsyncReprojectionFrameCache::EnsurePresentFallback_RenderThread(FRHICommandListImmediate& RHICmdList, int32 PlayerIndex, const FIntPoint& Extent, EPixelFormat ColorFormat)
 {
+	FPlayerSlot* PlayerSlot = PlayerSlots.Find(PlayerIndex);
+	if (PlayerSlot == nullptr)
+	{
+		return;
+	}
+
+	FCachedTargets& Slot = PlayerSlot->Targets;
+	if (Slot.BudgetTier >= BudgetTierNoPresentFallback)
+	{
+		// The memory governor dropped the fallback for this player; cache misses fall back to world rendering.
+		return;
+	}
+
 	bool bNeedsAlloc = false;
+	if (!Slot.PresentFallbackColor.IsValid())
 	{
-		FRWScopeLock Lock(CacheLock, SLT_ReadOnly);
-		if (const FCachedTargets* Existing = CacheByPlayer.Find(PlayerIndex))
-		{
-			if (!Existing->PresentFallbackColor.IsValid())
-			{
-				bNeedsAlloc = true;
-			}
-			else
-			{
-				const FIntPoint ExistingExtent = Existing->PresentFallbackColor->GetDesc().Extent;
-				bNeedsAlloc = (ExistingExtent != Extent) || (Existing->PresentFallbackColor->GetDesc().Format != ColorFormat);
-			}
-		}
-		else
-		{
-			bNeedsAlloc = true;
-		}
+		bNeedsAlloc = true;
+	}
+	else
+	{
+		const FIntPoint ExistingExtent = Slot.PresentFallbackColor->GetDesc().Extent;
+		bNeedsAlloc = (ExistingExtent != Extent) || (Slot.PresentFallbackColor->GetDesc().Format != ColorFormat);
 	}
 
 	if (!bNeedsAlloc)
@@ -353,47 +910,206 @@ void FAsyncReprojectionFrameCache::EnsurePresentFallback_RenderThread(FRHIComman
 	TRefCountPtr<IPooledRenderTarget> NewFallback;
 	GRenderTargetPool.FindFreeElement(RHICmdList, FallbackDesc, NewFallback, TEXT("AsyncReprojection.PresentFallbackColor"));
 
-	{
-		FRWScopeLock Lock(CacheLock, SLT_Write);
-		FCachedTargets& Slot = CacheByPlayer.FindOrAdd(PlayerIndex);
-		Slot.PresentFallbackColor = NewFallback;
-		Slot.bPresentFallbackValid = false;
-	}
+	Slot.PresentFallbackColor = NewFallback;
+	Slot.bPresentFallbackValid = false;
+
+	UpdateMemoryStats_RenderThread();
 }
 
 bool FAsyncReprojectionFrameCache::GetPresentFallback_RenderThread(int32 PlayerIndex, TRefCountPtr<IPooledRenderTarget>& OutFallbackColor) const
 {
-	FRWScopeLock Lock(CacheLock, SLT_ReadOnly);
-	const FCachedTargets* Cached = CacheByPlayer.Find(PlayerIndex);
-	if (Cached == nullptr || !Cached->bPresentFallbackValid || !Cached->PresentFallbackColor.IsValid())
+	const FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+	if (Slot == nullptr || !Slot->Targets.bPresentFallbackValid || !Slot->Targets.PresentFallbackColor.IsValid())
 	{
 		return false;
 	}
 
-	OutFallbackColor = Cached->PresentFallbackColor;
+	OutFallbackColor = Slot->Targets.PresentFallbackColor;
 	return true;
 }
 
 bool FAsyncReprojectionFrameCache::GetPresentFallbackTarget_RenderThread(int32 PlayerIndex, TRefCountPtr<IPooledRenderTarget>& OutFallbackColor) const
 {
-	FRWScopeLock Lock(CacheLock, SLT_ReadOnly);
-	const FCachedTargets* Cached = CacheByPlayer.Find(PlayerIndex);
-	if (Cached == nullptr || !Cached->PresentFallbackColor.IsValid())
+	const FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+	if (Slot == nullptr || !Slot->Targets.PresentFallbackColor.IsValid())
 	{
 		return false;
 	}
 
-	OutFallbackColor = Cached->PresentFallbackColor;
+	OutFallbackColor = Slot->Targets.PresentFallbackColor;
 	return true;
 }
 
 void FAsyncReprojectionFrameCache::SetPresentFallbackValid_RenderThread(int32 PlayerIndex, bool bValid)
 {
-	FRWScopeLock Lock(CacheLock, SLT_Write);
-	if (FCachedTargets* Cached = CacheByPlayer.Find(PlayerIndex))
+	if (FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex))
+	{
+		Slot->Targets.bPresentFallbackValid = bValid && Slot->Targets.PresentFallbackColor.IsValid();
+	}
+}
+
+void FAsyncReprojectionFrameCache::ReleaseIdleTargets_RenderThread(double NowSeconds, float IdleReleaseSeconds)
+{
+	if (IdleReleaseSeconds <= 0.0f)
+	{
+		return;
+	}
+
+	for (int32 PlayerIndex = 0; PlayerIndex < PlayerSlots.Num(); PlayerIndex++)
+	{
+		const FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+		if (ComputeSlotBytes(Slot->Targets) == 0)
+		{
+			continue;
+		}
+
+		const double LastUse = Slot->LastUseTimeSeconds.load(std::memory_order_relaxed);
+		if ((NowSeconds - LastUse) > double(IdleReleaseSeconds))
+		{
+			UE_LOG(LogAsyncReprojection, Log, TEXT("FrameCache releasing targets for PlayerIndex=%d after %.1fs idle."), PlayerIndex, IdleReleaseSeconds);
+			ReleasePlayerTargets_RenderThread(PlayerIndex);
+		}
+	}
+}
+
+void FAsyncReprojectionFrameCache::ReleaseAllTargets_RenderThread()
+{
+	if (AllocatedBytes.load(std::memory_order_relaxed) == 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogAsyncReprojection, Log, TEXT("FrameCache releasing targets for %d player slot(s)."), PlayerSlots.Num());
+	for (int32 PlayerIndex = 0; PlayerIndex < PlayerSlots.Num(); PlayerIndex++)
+	{
+		ReleasePlayerTargets_RenderThread(PlayerIndex);
+	}
+}
+
+int64 FAsyncReprojectionFrameCache::GetAllocatedBytes_AnyThread() const
+{
+	return AllocatedBytes.load(std::memory_order_relaxed);
+}
+
+void FAsyncReprojectionFrameCache::GrowPlayerSlots_GameThread(int32 NumPlayers)
+{
+	PlayerSlots.Grow_GameThread(NumPlayers);
+}
+
+int32 FAsyncReprojectionFrameCache::GetNumPlayerSlots() const
+{
+	return PlayerSlots.Num();
+}
+
+void FAsyncReprojectionFrameCache::ReleasePlayerTargets_RenderThread(int32 PlayerIndex)
+{
+	FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+	if (Slot == nullptr || ComputeSlotBytes(Slot->Targets) == 0)
 	{
-		Cached->bPresentFallbackValid = bValid && Cached->PresentFallbackColor.IsValid();
+		return;
 	}
+
+	Slot->Targets = FCachedTargets();
+	Slot->Capture.Reset();
+	Slot->LastUseTimeSeconds.store(0.0, std::memory_order_relaxed);
+
+	UpdateMemoryStats_RenderThread();
+}
+
+void FAsyncReprojectionFrameCache::UpdateMemoryStats_RenderThread()
+{
+	int64 TotalBytes = 0;
+	for (int32 PlayerIndex = 0; PlayerIndex < PlayerSlots.Num(); PlayerIndex++)
+	{
+		TotalBytes += ComputeSlotBytes(PlayerSlots.Find(PlayerIndex)->Targets);
+	}
+
+	AllocatedBytes.store(TotalBytes, std::memory_order_relaxed);
+	SET_MEMORY_STAT(STAT_AsyncReprojectionFrameCacheMemory, TotalBytes);
+
+	int64 CaptureTrafficBytes = 0;
+	int64 WarpTrafficBytes = 0;
+	for (int32 PlayerIndex = 0; PlayerIndex < PlayerSlots.Num(); PlayerIndex++)
+	{
+		const FCachedTargets& Targets = PlayerSlots.Find(PlayerIndex)->Targets;
+		CaptureTrafficBytes += Targets.CaptureTrafficBytes;
+		WarpTrafficBytes += Targets.WarpTrafficBytes;
+	}
+
+	SET_MEMORY_STAT(STAT_AsyncReprojectionCaptureTraffic, CaptureTrafficBytes);
+	SET_MEMORY_STAT(STAT_AsyncReprojectionWarpTraffic, WarpTrafficBytes);
+}
+
+void FAsyncReprojectionFrameCache::ReportTraffic_RenderThread(int32 PlayerIndex, const FSceneView& View, const FIntPoint& CaptureSize, EPixelFormat SourceFormat, bool bDisplayResolution)
+{
+	FPlayerSlot* Slot = PlayerSlots.Find(PlayerIndex);
+	if (Slot == nullptr || !Slot->Targets.Color.IsValid() || !Slot->Targets.DepthDeviceZ.IsValid())
+	{
+		return;
+	}
+
+	FCachedTargets& Targets = Slot->Targets;
+	const EPixelFormat ColorFormat = Targets.Color->GetDesc().Format;
+	const EPixelFormat DepthFormat = Targets.DepthDeviceZ->GetDesc().Format;
+	const bool bObjectMotion = Targets.ObjectMotion.IsValid();
+
+	const FIntPoint RenderSize = View.ViewRect.Size();
+	const FIntPoint DisplaySize = View.UnconstrainedViewRect.IsEmpty() ? View.UnscaledViewRect.Size() : View.UnconstrainedViewRect.Size();
+
+	// The formats of the mode not in use are not known here: internal SceneColor is assumed half-float and the back
+	// buffer 8-bit, which is what the default renderer settings produce.
+	const EPixelFormat OutputFormat = bDisplayResolution ? SourceFormat : PF_B8G8R8A8;
+	const EPixelFormat InternalSourceFormat = bDisplayResolution ? PF_FloatRGBA : SourceFormat;
+	const FIntPoint InternalExtent = bDisplayResolution ? RenderSize : CaptureSize;
+	const FIntPoint DisplayExtent = bDisplayResolution ? CaptureSize : DisplaySize;
+
+	const int64 InternalCaptureBytes = AsyncReprojectionFrameCachePrivate::EstimateCaptureTrafficBytes(InternalExtent, RenderSize, InternalSourceFormat, ColorFormat, DepthFormat, bObjectMotion);
+	const int64 InternalWarpBytes = AsyncReprojectionFrameCachePrivate::EstimateWarpTrafficBytes(RenderSize, DisplaySize, ColorFormat, DepthFormat, OutputFormat, bObjectMotion);
+	const int64 DisplayCaptureBytes = AsyncReprojectionFrameCachePrivate::EstimateCaptureTrafficBytes(DisplayExtent, RenderSize, OutputFormat, ColorFormat, DepthFormat, bObjectMotion);
+	const int64 DisplayWarpBytes = AsyncReprojectionFrameCachePrivate::EstimateWarpTrafficBytes(DisplaySize, DisplaySize, ColorFormat, DepthFormat, OutputFormat, bObjectMotion);
+
+	const int64 CaptureTrafficBytes = bDisplayResolution ? DisplayCaptureBytes : InternalCaptureBytes;
+	const int64 WarpTrafficBytes = bDisplayResolution ? DisplayWarpBytes : InternalWarpBytes;
+	if (Targets.CaptureTrafficBytes != CaptureTrafficBytes || Targets.WarpTrafficBytes != WarpTrafficBytes)
+	{
+		Targets.CaptureTrafficBytes = CaptureTrafficBytes;
+		Targets.WarpTrafficBytes = WarpTrafficBytes;
+		UpdateMemoryStats_RenderThread();
+	}
+
+	// Dynamic resolution changes the estimates every few frames; only log when the targets or the capture mode change.
+	const FIntPoint AllocatedExtent = Targets.Color->GetDesc().Extent;
+	if (Targets.ReportedTrafficExtent == AllocatedExtent && Targets.bReportedDisplayResolution == bDisplayResolution)
+	{
+		return;
+	}
+
+	Targets.ReportedTrafficExtent = AllocatedExtent;
+	Targets.bReportedDisplayResolution = bDisplayResolution;
+
+	UE_LOG(
+		LogAsyncReprojection,
+		Log,
+		TEXT("FrameCache PlayerIndex=%d captures at %s resolution. Internal (%dx%d): ~%.2f MB per capture, ~%.2f MB per warped present. Display (%dx%d): ~%.2f MB per capture, ~%.2f MB per warped present."),
+		PlayerIndex,
+		bDisplayResolution ? TEXT("display") : TEXT("internal"),
+		RenderSize.X,
+		RenderSize.Y,
+		AsyncReprojectionFrameCachePrivate::BytesToMB(InternalCaptureBytes),
+		AsyncReprojectionFrameCachePrivate::BytesToMB(InternalWarpBytes),
+		DisplaySize.X,
+		DisplaySize.Y,
+		AsyncReprojectionFrameCachePrivate::BytesToMB(DisplayCaptureBytes),
+		AsyncReprojectionFrameCachePrivate::BytesToMB(DisplayWarpBytes));
+}
+
+int64 FAsyncReprojectionFrameCache::ComputeSlotBytes(const FCachedTargets& Slot)
+{
+	return AsyncReprojectionFrameCachePrivate::ComputeTargetBytes(Slot.Color)
+		+ AsyncReprojectionFrameCachePrivate::ComputeTargetBytes(Slot.DepthDeviceZ)
+		+ AsyncReprojectionFrameCachePrivate::ComputeTargetBytes(Slot.ObjectMotion)
+		+ AsyncReprojectionFrameCachePrivate::ComputeTargetBytes(Slot.PresentFallbackColor)
+		+ AsyncReprojectionFrameCachePrivate::ComputeTargetBytes(Slot.FarField);
 }
 
 FMatrix44f FAsyncReprojectionFrameCache::ComputeSVPositionToTranslatedWorld(const FSceneView& View, const FIntRect& ViewRect, const FIntPoint& RasterContextSize)
@@ -3,15 +3,19 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AsyncReprojectionPlayerTable.h"
+#include "AsyncReprojectionSnapshotChannel.h"
+#include "RenderGraphDefinitions.h"
+#include "RendererInterface.h"
 
 #include <atomic>
 
 class FRDGBuilder;
 class FSceneView;
+struct FSceneTextureUniformParameters;
 
+struct FAsyncReprojectionCVarState;
 struct FPostProcessMaterialInputs;
-template<typename T> class TRefCountPtr;
-struct IPooledRenderTarget;
 
 /**
  * @struct FAsyncReprojectionCachedFrameConstants
@@ -22,9 +26,16 @@ struct FAsyncReprojectionCachedFrameConstants
 {
 	bool bValid = false;
 
+	/**
+	 * Active sub-rect of the cached targets. Targets only grow, so with dynamic resolution this is usually smaller than
+	 * BufferExtent and moves with every resolution change.
+	 */
 	FIntRect ViewRect = FIntRect(0, 0, 0, 0);
 	FIntPoint BufferExtent = FIntPoint(0, 0);
 
+	/** Output pixels the view is presented to; the cached warp scales ViewRect onto it. */
+	FIntRect OutputRect = FIntRect(0, 0, 0, 0);
+
 	FQuat RenderedRotation = FQuat::Identity;
 	FVector RenderedLocation = FVector::ZeroVector;
 	FVector PreViewTranslation = FVector::ZeroVector;
@@ -32,8 +43,20 @@ struct FAsyncReprojectionCachedFrameConstants
 	FMatrix44f ViewToClip = FMatrix44f::Identity;
 	FMatrix44f ClipToView = FMatrix44f::Identity;
 
+	/** Overscan scale the frame was rendered with; OutputRect shows the centre 1 / OverscanScale of ViewRect. */
+	float OverscanScale = 1.0f;
+
 	FMatrix44f RenderedSVPositionToTranslatedWorld = FMatrix44f::Identity;
 
+	/** Stereo eye captures are warped by head motion relative to the head pose they were rendered with. */
+	bool bStereoEye = false;
+	FQuat RenderedHeadRotation = FQuat::Identity;
+	FVector RenderedHeadLocation = FVector::ZeroVector;
+	bool bRenderedHeadValid = false;
+
+	/** Captured from the upscaled view family output; ViewRect is then in display pixels. */
+	bool bCapturedAtDisplayResolution = false;
+
 	ERHIFeatureLevel::Type FeatureLevel = ERHIFeatureLevel::SM5;
 
 	uint64 RenderThreadFrameCounter = 0;
@@ -43,16 +66,41 @@ struct FAsyncReprojectionCachedFrameConstants
 /**
  * @class FAsyncReprojectionFrameCache
  *
- * Stores the last fully rendered SceneColor and extracted device-Z depth for cached-frame reprojection.
+ * Stores the last fully rendered SceneColor, extracted device-Z depth, optional object motion and an optional
+ * far-field map for cached-frame reprojection.
+ * Captures either the internal-resolution SceneColor during post processing or, with
+ * r.AsyncReprojection.FrameCache.CaptureAtDisplayResolution, the upscaled view family output.
+ * Allocations are governed by r.AsyncReprojection.FrameCache.BudgetMB and released when idle or when the pipeline is disabled.
+ * Targets are owned by the rendering thread; only the capture constants and their frame/time tags are published for other threads.
  */
 class FAsyncReprojectionFrameCache final
 {
 public:
 	static FAsyncReprojectionFrameCache& Get();
 
+	/** Whether this frame captures from the view family output rather than during post processing. */
+	static bool ShouldCaptureAtDisplayResolution(const FAsyncReprojectionCVarState& CVarState);
+
 	void Update_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessMaterialInputs& Inputs);
 
-	bool GetCachedFrame_RenderThread(int32 PlayerIndex, TRefCountPtr<IPooledRenderTarget>& OutColor, TRefCountPtr<IPooledRenderTarget>& OutDepthDeviceZ, FAsyncReprojectionCachedFrameConstants& OutConstants) const;
+	/**
+	 * Captures the view's region of the upscaled view family texture. Called after the view family has rendered and
+	 * before any PostRenderViewFamily warp modifies it.
+	 */
+	void UpdateAtDisplayResolution_RenderThread(
+		FRDGBuilder& GraphBuilder,
+		const FSceneView& View,
+		FRDGTextureRef ViewFamilyTexture,
+		TRDGUniformBufferRef<FSceneTextureUniformParameters> SceneTextures);
+
+	/** Gets the player's cached frame for a warp and marks it used, which keeps its targets from being released as idle. */
+	bool AcquireCachedFrame_RenderThread(int32 PlayerIndex, TRefCountPtr<IPooledRenderTarget>& OutColor, TRefCountPtr<IPooledRenderTarget>& OutDepthDeviceZ, FAsyncReprojectionCachedFrameConstants& OutConstants);
+
+	/** Per-pixel object motion in cached-buffer pixels per second; only captured with r.AsyncReprojection.AsyncPresent.ObjectMotion. */
+	bool GetCachedObjectMotion_RenderThread(int32 PlayerIndex, TRefCountPtr<IPooledRenderTarget>& OutObjectMotion) const;
+
+	/** Octahedral map of distant content around the player's camera; only kept with r.AsyncReprojection.FarField. */
+	bool GetCachedFarField_RenderThread(int32 PlayerIndex, TRefCountPtr<IPooledRenderTarget>& OutFarField) const;
 
 	bool HasCachedFrame_AnyThread(int32 PlayerIndex) const;
 	bool HasUsableCachedFrame_AnyThread(int32 PlayerIndex, double NowSeconds, int32 MaxCacheAgeMs) const;
@@ -63,28 +111,112 @@ public:
 	bool GetPresentFallbackTarget_RenderThread(int32 PlayerIndex, TRefCountPtr<IPooledRenderTarget>& OutFallbackColor) const;
 	void SetPresentFallbackValid_RenderThread(int32 PlayerIndex, bool bValid);
 
+	/** Releases targets of players that neither captured nor presented for longer than IdleReleaseSeconds. */
+	void ReleaseIdleTargets_RenderThread(double NowSeconds, float IdleReleaseSeconds);
+	void ReleaseAllTargets_RenderThread();
+
+	int64 GetAllocatedBytes_AnyThread() const;
+
+	/** Grows the per-player slot table; called by FAsyncReprojectionCameraTracker::RegisterPlayers_GameThread. */
+	void GrowPlayerSlots_GameThread(int32 NumPlayers);
+	int32 GetNumPlayerSlots() const;
+
 private:
 	FAsyncReprojectionFrameCache() = default;
 	~FAsyncReprojectionFrameCache() = default;
 
-	void EnsureTargets_RenderThread(FRHICommandListImmediate& RHICmdList, int32 PlayerIndex, const FIntPoint& Extent, EPixelFormat ColorFormat);
+	/**
+	 * Copies SourceColor into the player's cached targets and records the constants of the capture.
+	 *
+	 * @param CachedViewRect View region of SourceColor; scene depth is sampled over View.ViewRect and remapped onto it.
+	 * @param OutputRect Output pixels the view is presented to.
+	 */
+	void Capture_RenderThread(
+		FRDGBuilder& GraphBuilder,
+		const FSceneView& View,
+		FRDGTextureRef SourceColor,
+		const FIntRect& CachedViewRect,
+		const FIntRect& OutputRect,
+		TRDGUniformBufferRef<FSceneTextureUniformParameters> SceneTextures,
+		bool bDisplayResolution,
+		const FAsyncReprojectionCVarState& CVarState);
+
+	/**
+	 * Gathers a capture's distant content into the player's far-field map, allocating or clearing the map as needed.
+	 * Releases the map when r.AsyncReprojection.FarField is off or the memory governor dropped it.
+	 */
+	void UpdateFarField_RenderThread(
+		FRDGBuilder& GraphBuilder,
+		int32 PlayerIndex,
+		const FAsyncReprojectionCachedFrameConstants& Constants,
+		FRDGTextureRef CachedColor,
+		FRDGTextureRef CachedDepthDeviceZ,
+		ERDGPassFlags PassFlags,
+		const FAsyncReprojectionCVarState& CVarState);
+
+	/** Publishes the approximate GPU traffic of the player's capture mode and logs it, with the alternative, when it changes. */
+	void ReportTraffic_RenderThread(int32 PlayerIndex, const FSceneView& View, const FIntPoint& CaptureSize, EPixelFormat SourceFormat, bool bDisplayResolution);
+
+	/**
+	 * Makes the player's targets at least RequiredExtent; existing larger targets are kept so resolution changes do not
+	 * reallocate or drop the cached frame. Returns false when the memory budget refuses a capture for this player.
+	 *
+	 * @param bFarField Whether the capture would keep a far-field map, which the budget accounts for and drops first.
+	 */
+	bool EnsureTargets_RenderThread(FRHICommandListImmediate& RHICmdList, int32 PlayerIndex, const FIntPoint& RequiredExtent, EPixelFormat ColorFormat, bool bFarField, const FAsyncReprojectionCVarState& CVarState);
+	uint8 SelectBudgetTier_RenderThread(int32 PlayerIndex, const FIntPoint& Extent, EPixelFormat ColorFormat, EPixelFormat ReducedColorFormat, EPixelFormat ReducedDepthFormat, bool bObjectMotion, int32 FarFieldSize, int32 BudgetMB) const;
+	void ReleasePlayerTargets_RenderThread(int32 PlayerIndex);
+	void UpdateMemoryStats_RenderThread();
 
 	static FMatrix44f ComputeSVPositionToTranslatedWorld(const FSceneView& View, const FIntRect& ViewRect, const FIntPoint& RasterContextSize);
 
 private:
+	/** Memory governor degradation steps, applied in order until the cache fits the budget. */
+	static constexpr uint8 BudgetTierFull = 0;
+	static constexpr uint8 BudgetTierNoFarField = 1;
+	static constexpr uint8 BudgetTierReducedFormats = 2;
+	static constexpr uint8 BudgetTierNoPresentFallback = 3;
+	static constexpr uint8 BudgetTierRefused = 4;
+
 	struct FCachedTargets
 	{
 		TRefCountPtr<IPooledRenderTarget> Color;
 		TRefCountPtr<IPooledRenderTarget> DepthDeviceZ;
+		TRefCountPtr<IPooledRenderTarget> ObjectMotion;
 		TRefCountPtr<IPooledRenderTarget> PresentFallbackColor;
 		bool bPresentFallbackValid = false;
+		/** World-oriented, so it survives reallocation of the other targets; cleared when the camera leaves FarFieldOrigin. */
+		TRefCountPtr<IPooledRenderTarget> FarField;
+		FVector FarFieldOrigin = FVector::ZeroVector;
+		bool bFarFieldValid = false;
+		uint8 BudgetTier = BudgetTierFull;
 		FAsyncReprojectionCachedFrameConstants Constants;
+
+		/** Approximate bytes moved per capture and per warped present in the current capture mode. */
+		int64 CaptureTrafficBytes = 0;
+		int64 WarpTrafficBytes = 0;
+		/** Target extent and capture mode of the last traffic log line. */
+		FIntPoint ReportedTrafficExtent = FIntPoint::ZeroValue;
+		bool bReportedDisplayResolution = false;
+	};
+
+	/**
+	 * @struct FPlayerSlot
+	 *
+	 * One local player's cache entry. Targets are only touched on the rendering thread and need no lock; the published
+	 * capture sits on its own cache line because the game thread polls it every frame.
+	 */
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FPlayerSlot
+	{
+		FCachedTargets Targets;
+
+		/** Constants of the last valid capture, tagged with its rendering-thread frame and time; zero tags when none. */
+		alignas(PLATFORM_CACHE_LINE_SIZE) TAsyncReprojectionSnapshotChannel<FAsyncReprojectionCachedFrameConstants> Capture;
+		std::atomic<double> LastUseTimeSeconds { 0.0 };
 	};
 
-	mutable FRWLock CacheLock;
-	TMap<int32, FCachedTargets> CacheByPlayer;
+	static int64 ComputeSlotBytes(const FCachedTargets& Slot);
 
-	static constexpr int32 MaxCachedPlayers = 4;
-	std::atomic<uint64> LastValidCaptureFrameCounter[MaxCachedPlayers] = {};
-	std::atomic<double> LastCaptureTimeSeconds[MaxCachedPlayers] = {};
+	TAsyncReprojectionPlayerTable<FPlayerSlot> PlayerSlots { 1 };
+	std::atomic<int64> AllocatedBytes { 0 };
 };
@@ -0,0 +1,139 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#include "AsyncReprojectionInputCalibration.h"
+
+#include "AsyncReprojection.h"
+#include "AsyncReprojectionCVars.h"
+
+namespace AsyncReprojectionInputCalibrationPrivate
+{
+	/** Axis movement below this many pixels is sensor noise or rounding, not a look input. */
+	static constexpr double MinSamplePixels = 1.0;
+
+	/** A larger turn in one frame is a camera cut, respawn or scripted camera rather than a response to the mouse. */
+	static constexpr double MaxSampleTurnDegrees = 30.0;
+
+	/** Near the pitch limits the game clamps pitch and yaw becomes ill-defined, so those frames are not sampled. */
+	static constexpr double MaxSamplePitchDegrees = 80.0;
+
+	/** A published gain is only logged again once it moves by more than this fraction. */
+	static constexpr float LogRelativeChange = 0.05f;
+}
+
+FAsyncReprojectionInputCalibration& FAsyncReprojectionInputCalibration::Get()
+{
+	static FAsyncReprojectionInputCalibration Instance;
+	return Instance;
+}
+
+void FAsyncReprojectionInputCalibration::FAxisFit::Add(double Pixels, double Degrees, double Forgetting)
+{
+	SumPixelsSquared = SumPixelsSquared * Forgetting + Pixels * Pixels;
+	SumPixelsDegrees = SumPixelsDegrees * Forgetting + Pixels * Degrees;
+	SumDegreesSquared = SumDegreesSquared * Forgetting + Degrees * Degrees;
+	Weight = Weight * Forgetting + 1.0;
+}
+
+double FAsyncReprojectionInputCalibration::FAxisFit::GetGain() const
+{
+	return SumPixelsSquared > UE_DOUBLE_SMALL_NUMBER ? SumPixelsDegrees / SumPixelsSquared : 0.0;
+}
+
+double FAsyncReprojectionInputCalibration::FAxisFit::GetConfidence() const
+{
+	const double Denominator = SumPixelsSquared * SumDegreesSquared;
+	if (Denominator <= UE_DOUBLE_SMALL_NUMBER)
+	{
+		return 0.0;
+	}
+
+	// Uncentered R^2 of the fit through the origin.
+	return FMath::Clamp((SumPixelsDegrees * SumPixelsDegrees) / Denominator, 0.0, 1.0);
+}
+
+void FAsyncReprojectionInputCalibration::AddSample_GameThread(const FAsyncReprojectionCVarState& CVarState, const FVector2f& MousePixels, const FRotator& PreviousRotation, const FRotator& CurrentRotation)
+{
+	using namespace AsyncReprojectionInputCalibrationPrivate;
+
+	check(IsInGameThread());
+
+	if (!CVarState.bInputAutoCalibrate)
+	{
+		// Turning calibration off discards the fit, so toggling it restarts calibration from scratch.
+		if (YawFit.Weight > 0.0 || PitchFit.Weight > 0.0)
+		{
+			Reset_GameThread();
+		}
+		return;
+	}
+
+	if (FMath::Abs(PreviousRotation.Pitch) > MaxSamplePitchDegrees || FMath::Abs(CurrentRotation.Pitch) > MaxSamplePitchDegrees)
+	{
+		return;
+	}
+
+	const double YawDegrees = FRotator::NormalizeAxis(CurrentRotation.Yaw - PreviousRotation.Yaw);
+	const double PitchDegrees = FRotator::NormalizeAxis(CurrentRotation.Pitch - PreviousRotation.Pitch);
+	if (FMath::Abs(YawDegrees) > MaxSampleTurnDegrees || FMath::Abs(PitchDegrees) > MaxSampleTurnDegrees)
+	{
+		return;
+	}
+
+	const int32 MinSamples = FMath::Max(1, CVarState.InputAutoCalibrateMinSamples);
+	const double WindowSamples = double(FMath::Max(CVarState.InputAutoCalibrateWindowSamples, 2 * MinSamples));
+	const double Forgetting = 1.0 - 1.0 / WindowSamples;
+
+	// Pitch gains follow the InputPitchDegreesPerPixel convention: moving the mouse up (negative Y) pitches up.
+	if (FMath::Abs(MousePixels.X) >= MinSamplePixels)
+	{
+		YawFit.Add(MousePixels.X, YawDegrees, Forgetting);
+		PublishAxis_GameThread(CVarState, YawFit, PublishedYawDegreesPerPixel, TEXT("Yaw"));
+	}
+
+	if (FMath::Abs(MousePixels.Y) >= MinSamplePixels)
+	{
+		PitchFit.Add(-MousePixels.Y, PitchDegrees, Forgetting);
+		PublishAxis_GameThread(CVarState, PitchFit, PublishedPitchDegreesPerPixel, TEXT("Pitch"));
+	}
+}
+
+void FAsyncReprojectionInputCalibration::PublishAxis_GameThread(const FAsyncReprojectionCVarState& CVarState, const FAxisFit& Fit, std::atomic<float>& Published, const TCHAR* AxisName)
+{
+	using namespace AsyncReprojectionInputCalibrationPrivate;
+
+	// Below the gates the last confident gain stays in use; a noisy stretch of play does not revert to the CVar.
+	const double Confidence = Fit.GetConfidence();
+	if (Fit.Weight < double(FMath::Max(1, CVarState.InputAutoCalibrateMinSamples)) || Confidence < double(CVarState.InputAutoCalibrateMinConfidence))
+	{
+		return;
+	}
+
+	const float Gain = float(Fit.GetGain());
+	if (Gain == 0.0f)
+	{
+		return;
+	}
+
+	const float Previous = Published.exchange(Gain, std::memory_order_relaxed);
+	if (Previous == 0.0f || FMath::Abs(Gain - Previous) > FMath::Abs(Previous) * LogRelativeChange)
+	{
+		UE_LOG(LogAsyncReprojection, Log, TEXT("Input calibration: %s %.4f degrees per pixel (confidence %.3f over %.0f samples)."), AxisName, Gain, Confidence, Fit.Weight);
+	}
+}
+
+void FAsyncReprojectionInputCalibration::Reset_GameThread()
+{
+	check(IsInGameThread());
+
+	YawFit = FAxisFit();
+	PitchFit = FAxisFit();
+	PublishedYawDegreesPerPixel.store(0.0f, std::memory_order_relaxed);
+	PublishedPitchDegreesPerPixel.store(0.0f, std::memory_order_relaxed);
+}
+
+FVector2f FAsyncReprojectionInputCalibration::GetDegreesPerPixel_AnyThread() const
+{
+	return FVector2f(
+		PublishedYawDegreesPerPixel.load(std::memory_order_relaxed),
+		PublishedPitchDegreesPerPixel.load(std::memory_order_relaxed));
+}
@@ -0,0 +1,76 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+struct FAsyncReprojectionCVarState;
+
+/**
+ * @class FAsyncReprojectionInputCalibration
+ *
+ * Fits InputDrivenPose's yaw and pitch degrees per mouse pixel from gameplay. Each end-of-frame camera sample pairs the
+ * mouse movement consumed by that frame with the PlayerCameraManager rotation change it produced; a least-squares line
+ * through the origin with exponential forgetting estimates the gain of each axis, and a gain is only published once
+ * enough samples agree with it (r.AsyncReprojection.InputAutoCalibrate.*). FAsyncReprojectionCVars::Get() substitutes
+ * the published gains for r.AsyncReprojection.InputYawDegreesPerPixel / InputPitchDegreesPerPixel.
+ */
+class FAsyncReprojectionInputCalibration final
+{
+public:
+	static FAsyncReprojectionInputCalibration& Get();
+
+	/**
+	 * Adds one frame of mouse movement and the camera rotation change over the same frame.
+	 *
+	 * @param CVarState Calibration settings.
+	 * @param MousePixels Mouse movement in pixels (positive = right and down).
+	 * @param PreviousRotation Camera rotation at the previous sample.
+	 * @param CurrentRotation Camera rotation now.
+	 */
+	void AddSample_GameThread(const FAsyncReprojectionCVarState& CVarState, const FVector2f& MousePixels, const FRotator& PreviousRotation, const FRotator& CurrentRotation);
+
+	/** Forgets all samples and published gains, e.g. when the game changes its look sensitivity. */
+	void Reset_GameThread();
+
+	/**
+	 * Gets the published gains (thread safe).
+	 *
+	 * @return Yaw and pitch degrees per pixel; an axis without a confident fit is 0.
+	 */
+	FVector2f GetDegreesPerPixel_AnyThread() const;
+
+private:
+	FAsyncReprojectionInputCalibration() = default;
+
+	/**
+	 * @struct FAxisFit
+	 *
+	 * Running least-squares fit of Degrees = Gain * Pixels for one axis. Sums decay by the forgetting factor so the fit
+	 * follows sensitivity changes.
+	 */
+	struct FAxisFit
+	{
+		double SumPixelsSquared = 0.0;
+		double SumPixelsDegrees = 0.0;
+		double SumDegreesSquared = 0.0;
+		double Weight = 0.0;
+
+		void Add(double Pixels, double Degrees, double Forgetting);
+		double GetGain() const;
+
+		/** Fraction of the camera rotation the fitted gain explains, in [0, 1]. */
+		double GetConfidence() const;
+	};
+
+	void PublishAxis_GameThread(const FAsyncReprojectionCVarState& CVarState, const FAxisFit& Fit, std::atomic<float>& Published, const TCHAR* AxisName);
+
+	/** Game thread only. */
+	FAxisFit YawFit;
+	FAxisFit PitchFit;
+
+	std::atomic<float> PublishedYawDegreesPerPixel { 0.0f };
+	std::atomic<float> PublishedPitchDegreesPerPixel { 0.0f };
+};
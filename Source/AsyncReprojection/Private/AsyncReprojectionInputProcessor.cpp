@@ -6,6 +6,7 @@
 #include "AsyncReprojectionCVars.h"
 
 #include "Framework/Application/SlateApplication.h"
+#include "InputCoreTypes.h"
 
 void FAsyncReprojectionInputProcessor::Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor)
 {
@@ -19,7 +20,7 @@ bool FAsyncReprojectionInputProcessor::HandleMouseMoveEvent(FSlateApplication& S
 	(void)SlateApp;
 
 	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
-	if (!CVarState.bInputDrivenPose)
+	if (!CVarState.bInputDrivenPose && CVarState.PoseProvider == 0)
 	{
 		return false;
 	}
@@ -30,3 +31,34 @@ bool FAsyncReprojectionInputProcessor::HandleMouseMoveEvent(FSlateApplication& S
 
 	return false;
 }
+
+bool FAsyncReprojectionInputProcessor::HandleAnalogInputEvent(FSlateApplication& SlateApp, const FAnalogInputEvent& InAnalogInputEvent)
+{
+	(void)SlateApp;
+
+	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
+	if (!CVarState.bInputDrivenPose && CVarState.PoseProvider == 0)
+	{
+		return false;
+	}
+
+	const FKey Key = InAnalogInputEvent.GetKey();
+	EAxis::Type Axis = EAxis::None;
+	if (Key == EKeys::Gamepad_RightX)
+	{
+		Axis = EAxis::X;
+	}
+	else if (Key == EKeys::Gamepad_RightY)
+	{
+		Axis = EAxis::Y;
+	}
+	else
+	{
+		return false;
+	}
+
+	const int32 PlayerIndex = int32(InAnalogInputEvent.GetUserIndex());
+	FAsyncReprojectionCameraTracker::Get().SetLookStickAxis_GameThread(PlayerIndex, Axis, InAnalogInputEvent.GetAnalogValue());
+
+	return false;
+}
@@ -9,11 +9,12 @@
 /**
  * @class FAsyncReprojectionInputProcessor
  *
- * Slate input preprocessor that accumulates mouse deltas for InputDrivenPose.
+ * Slate input preprocessor that accumulates mouse deltas and right-stick deflection for InputDrivenPose.
  */
 class FAsyncReprojectionInputProcessor final : public IInputProcessor
 {
 public:
 	virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override;
 	virtual bool HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual bool HandleAnalogInputEvent(FSlateApplication& SlateApp, const FAnalogInputEvent& InAnalogInputEvent) override;
 };
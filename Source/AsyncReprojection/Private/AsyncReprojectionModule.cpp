@@ -4,10 +4,12 @@
 
 #include "AsyncReprojectionAsyncPresent.h"
 #include "AsyncReprojectionCameraTracker.h"
+#include "AsyncReprojectionCompositor.h"
 #include "AsyncReprojectionCVars.h"
 #include "AsyncReprojectionInputProcessor.h"
 #include "AsyncReprojectionSettings.h"
 #include "AsyncReprojectionViewExtension.h"
+#include "AsyncReprojectionViewScheduler.h"
 #include "AsyncReprojectionWarpPass.h"
 
 #include "Interfaces/IPluginManager.h"
@@ -58,6 +60,8 @@ void FAsyncReprojectionModule::StartupModule()
 		{
 			BackBufferPassHandle = SlateRenderer->OnAddBackBufferReadyToPresentPass().AddRaw(this, &FAsyncReprojectionModule::OnAddBackBufferReadyToPresentPass_RenderThread);
 			UE_LOG(LogAsyncReprojection, Log, TEXT("Attached back-buffer warp delegate."));
+
+			FAsyncReprojectionCompositor::Get().Startup();
 		}
 		else
 		{
@@ -81,6 +85,8 @@ void FAsyncReprojectionModule::ShutdownModule()
 		UE_LOG(LogAsyncReprojection, Verbose, TEXT("Removed deferred OnPostEngineInit handle."));
 	}
 
+	FAsyncReprojectionCompositor::Get().Shutdown();
+
 	if (FSlateApplication::IsInitialized())
 	{
 		if (InputProcessor.IsValid())
@@ -102,6 +108,7 @@ void FAsyncReprojectionModule::ShutdownModule()
 	bViewExtensionRegistered = false;
 	bCVarsInitialized = false;
 
+	FAsyncReprojectionViewScheduler::Get().Shutdown();
 	FAsyncReprojectionAsyncPresent::Get().Shutdown();
 	FAsyncReprojectionCameraTracker::Get().Shutdown();
 }
@@ -110,6 +117,7 @@ void FAsyncReprojectionModule::OnAddBackBufferReadyToPresentPass_RenderThread(FR
 {
 	UE_LOG(LogAsyncReprojection, VeryVerbose, TEXT("BackBufferReadyToPresent pass hook invoked (BackBuffer=%p)."), BackBuffer);
 
+	FAsyncReprojectionCompositor::Get().NotifySlatePresent_RenderThread();
 	FAsyncReprojectionCachedPresentWarp::AddBackBufferPassIfEnabled(GraphBuilder, SlateWindow, BackBuffer);
 	FAsyncReprojectionBackBufferWarp::AddPassIfEnabled(GraphBuilder, SlateWindow, BackBuffer);
 }
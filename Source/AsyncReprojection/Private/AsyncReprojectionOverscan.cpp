@@ -0,0 +1,203 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#include "AsyncReprojectionOverscan.h"
+
+#include "AsyncReprojectionAsyncPresent.h"
+#include "AsyncReprojectionCameraTracker.h"
+#include "AsyncReprojectionCVars.h"
+#include "AsyncReprojectionForeground.h"
+#include "AsyncReprojectionStereo.h"
+
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderingThread.h"
+#include "SceneView.h"
+#include "ScreenPass.h"
+
+namespace AsyncReprojectionOverscanPrivate
+{
+	/** Time constant of the margin closing once the camera slows down. */
+	static constexpr double ReleaseSeconds = 0.5;
+
+	/** Widened half FOVs beyond this stretch the projection more than any warp needs. */
+	static constexpr double MaxWidenedHalfFOVDegrees = 80.0;
+
+	/** Scales this close to 1 would crop by less than a pixel; the view is rendered unchanged instead. */
+	static constexpr float MinScale = 1.001f;
+}
+
+FAsyncReprojectionOverscan& FAsyncReprojectionOverscan::Get()
+{
+	static FAsyncReprojectionOverscan Instance;
+	return Instance;
+}
+
+void FAsyncReprojectionOverscan::SetupView_GameThread(const FAsyncReprojectionCVarState& CVarState, const FSceneViewFamily& InViewFamily, FSceneView& InView)
+{
+	using namespace AsyncReprojectionOverscanPrivate;
+
+	check(IsInGameThread());
+
+	// Views the pipeline never caches or warps leave the slot state alone.
+	if (!InView.bIsGameView || InView.bIsSceneCapture || InView.bIsReflectionCapture || InView.bIsPlanarReflection || !InView.IsPerspectiveProjection())
+	{
+		return;
+	}
+
+	const int32 ViewSlotIndex = FAsyncReprojectionStereo::GetViewSlotIndex(InView);
+	FSlotMargin& Slot = SlotMargins.FindOrAdd(ViewSlotIndex);
+
+	// Stereo eyes keep the HMD's projection; the XR runtime owns their borders. The crop needs the output PrePostProcessPass
+	// captures, so a family without post-processing would present the widened frame uncropped.
+	const bool bEnabled = CVarState.bOverscan
+		&& CVarState.Mode != EAsyncReprojectionMode::Off
+		&& InViewFamily.bResolveScene
+		&& InViewFamily.EngineShowFlags.PostProcessing
+		&& !FAsyncReprojectionStereo::IsStereoEyeView(InView)
+		&& (!GIsEditor || CVarState.bEnableInEditor);
+	if (!bEnabled)
+	{
+		Slot.MarginDegrees = 0.0f;
+		Slot.LastUpdateSeconds = 0.0;
+		PublishScale_GameThread(ViewSlotIndex, Slot, 1.0f);
+		return;
+	}
+
+	// A foreground-only view is composited over the cached warp at the display FOV; the margin carries over to the next
+	// full frame.
+	if (FAsyncReprojectionAsyncPresent::Get().IsForegroundOnlyFrame() && FAsyncReprojectionForeground::Get().HasForegroundPrimitives_GameThread())
+	{
+		PublishScale_GameThread(ViewSlotIndex, Slot, 1.0f);
+		return;
+	}
+
+	// The margin has to cover the turn the warp makes up for: the camera's speed over the lookahead.
+	const FAsyncReprojectionCameraSnapshot Camera = FAsyncReprojectionCameraTracker::Get().GetLatestCamera(InView.PlayerIndex);
+	const float SpeedDegreesPerSecond = Camera.bIsValid ? float(FMath::RadiansToDegrees(Camera.AngularVelocity.Size())) : 0.0f;
+	const float MaxDegrees = FMath::Max(0.0f, CVarState.OverscanMaxDegrees);
+	const float MinDegrees = FMath::Clamp(CVarState.OverscanMinDegrees, 0.0f, MaxDegrees);
+	const float TargetDegrees = FMath::Clamp(SpeedDegreesPerSecond * FMath::Max(0.0f, CVarState.OverscanLookaheadMs) / 1000.0f, MinDegrees, MaxDegrees);
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	if (TargetDegrees >= Slot.MarginDegrees || Slot.LastUpdateSeconds <= 0.0)
+	{
+		Slot.MarginDegrees = TargetDegrees;
+	}
+	else
+	{
+		const double Alpha = 1.0 - FMath::Exp(-(NowSeconds - Slot.LastUpdateSeconds) / ReleaseSeconds);
+		Slot.MarginDegrees = FMath::Lerp(Slot.MarginDegrees, TargetDegrees, float(Alpha));
+	}
+	Slot.LastUpdateSeconds = NowSeconds;
+
+	// The margin widens the horizontal half FOV; the vertical one scales with it so the aspect ratio is kept.
+	const FMatrix Projection = InView.ViewMatrices.GetProjectionMatrix();
+	const double TanHalfFOV = 1.0 / FMath::Max(FMath::Abs(Projection.M[0][0]), UE_DOUBLE_SMALL_NUMBER);
+	const double HalfFOVDegrees = FMath::RadiansToDegrees(FMath::Atan(TanHalfFOV));
+	const double WidenedHalfFOVDegrees = FMath::Min(HalfFOVDegrees + double(Slot.MarginDegrees), FMath::Max(HalfFOVDegrees, MaxWidenedHalfFOVDegrees));
+	float Scale = float(FMath::Tan(FMath::DegreesToRadians(WidenedHalfFOVDegrees)) / TanHalfFOV);
+	if (Scale < MinScale)
+	{
+		Scale = 1.0f;
+	}
+	else
+	{
+		InView.UpdateProjectionMatrix(ScaleProjection(Projection, Scale));
+	}
+
+	PublishScale_GameThread(ViewSlotIndex, Slot, Scale);
+}
+
+void FAsyncReprojectionOverscan::PublishScale_GameThread(int32 ViewSlotIndex, FSlotMargin& Slot, float Scale)
+{
+	if (Slot.PublishedScale == Scale)
+	{
+		return;
+	}
+
+	// Enqueued before this frame's rendering commands, so the rendering thread sees the scale of the frame it renders.
+	Slot.PublishedScale = Scale;
+	ENQUEUE_RENDER_COMMAND(AsyncReprojectionOverscanScale)(
+		[this, ViewSlotIndex, Scale](FRHICommandListImmediate& RHICmdList)
+		{
+			ScaleByViewSlot.Add(ViewSlotIndex, Scale);
+		});
+}
+
+float FAsyncReprojectionOverscan::GetScale_RenderThread(int32 ViewSlotIndex) const
+{
+	const float* Scale = ScaleByViewSlot.Find(ViewSlotIndex);
+	return Scale != nullptr ? *Scale : 1.0f;
+}
+
+FMatrix FAsyncReprojectionOverscan::ScaleProjection(const FMatrix& Projection, float Scale)
+{
+	// Clip x and y are columns 0 and 1 and clip w does not depend on them, so scaling the columns scales NDC.
+	const double InvScale = 1.0 / double(Scale);
+	FMatrix Scaled = Projection;
+	for (int32 Row = 0; Row < 4; Row++)
+	{
+		Scaled.M[Row][0] *= InvScale;
+		Scaled.M[Row][1] *= InvScale;
+	}
+	return Scaled;
+}
+
+FIntRect FAsyncReprojectionOverscan::GetDisplayRect(const FIntRect& ViewRect, float Scale)
+{
+	if (Scale <= 1.0f)
+	{
+		return ViewRect;
+	}
+
+	const FIntPoint Size = ViewRect.Size();
+	const FIntPoint DisplaySize(
+		FMath::Max(1, FMath::RoundToInt(float(Size.X) / Scale)),
+		FMath::Max(1, FMath::RoundToInt(float(Size.Y) / Scale)));
+	const FIntPoint Min = ViewRect.Min + (Size - DisplaySize) / 2;
+	return FIntRect(Min, Min + DisplaySize);
+}
+
+void FAsyncReprojectionOverscan::AddCropPasses_RenderThread(FRDGBuilder& GraphBuilder, const FSceneViewFamily& ViewFamily, FRDGTextureRef ViewFamilyTexture) const
+{
+	bool bAnyOverscan = false;
+	for (const FSceneView* View : ViewFamily.Views)
+	{
+		bAnyOverscan |= View != nullptr && GetScale_RenderThread(FAsyncReprojectionStereo::GetViewSlotIndex(*View)) > 1.0f;
+	}
+	if (!bAnyOverscan || ViewFamilyTexture == nullptr)
+	{
+		return;
+	}
+
+	RDG_EVENT_SCOPE(GraphBuilder, "AsyncReprojection OverscanCrop");
+
+	const FRDGTextureDesc Desc = ViewFamilyTexture->Desc;
+	FRDGTextureRef Source = GraphBuilder.CreateTexture(Desc, TEXT("AsyncReprojection.OverscanSource"));
+	AddCopyTexturePass(GraphBuilder, ViewFamilyTexture, Source);
+
+	for (const FSceneView* ViewPtr : ViewFamily.Views)
+	{
+		if (ViewPtr == nullptr)
+		{
+			continue;
+		}
+
+		const FSceneView& View = *ViewPtr;
+		const float Scale = GetScale_RenderThread(FAsyncReprojectionStereo::GetViewSlotIndex(View));
+		if (Scale <= 1.0f)
+		{
+			continue;
+		}
+
+		const FIntRect ViewRect = View.UnconstrainedViewRect.IsEmpty()
+			? FIntRect(FIntPoint::ZeroValue, Desc.Extent)
+			: View.UnconstrainedViewRect;
+
+		AddDrawTexturePass(
+			GraphBuilder,
+			FScreenPassViewInfo(View),
+			FScreenPassTexture(Source, GetDisplayRect(ViewRect, Scale)),
+			FScreenPassRenderTarget(ViewFamilyTexture, ViewRect, ERenderTargetLoadAction::ELoad));
+	}
+}
@@ -0,0 +1,81 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderGraphDefinitions.h"
+
+class FSceneView;
+class FSceneViewFamily;
+
+struct FAsyncReprojectionCVarState;
+
+/**
+ * @class FAsyncReprojectionOverscan
+ *
+ * Guard-band rendering (r.AsyncReprojection.Overscan). Each game view is rendered with its projection widened by a
+ * margin that follows the camera's recent angular speed, so the frame and its cache hold a band of world beyond the
+ * display FOV. Presented frames are cropped back to the display FOV, and cached warps sample the band instead of
+ * stretching or blacking out the border.
+ *
+ * The widening is expressed as a scale of at least 1: the rendered frustum's tangent half-extents divided by the
+ * display frustum's. The display FOV covers the centre 1 / Scale of the rendered view rect.
+ */
+class FAsyncReprojectionOverscan final
+{
+public:
+	static FAsyncReprojectionOverscan& Get();
+
+	/**
+	 * Widens a game view's projection by its player's current margin; called from the view extension's SetupView.
+	 * Families that skip post-processing never reach the pass that captures the output for cropping, so their views are
+	 * left at the display FOV.
+	 */
+	void SetupView_GameThread(const FAsyncReprojectionCVarState& CVarState, const FSceneViewFamily& InViewFamily, FSceneView& InView);
+
+	/**
+	 * Gets the scale the view slot's current frame was rendered with.
+	 *
+	 * @param ViewSlotIndex Frame cache slot of the view.
+	 * @return Widening scale; 1 when the view is not overscanned.
+	 */
+	float GetScale_RenderThread(int32 ViewSlotIndex) const;
+
+	/** Scales a projection's NDC x and y by 1 / Scale about the projection centre. */
+	static FMatrix ScaleProjection(const FMatrix& Projection, float Scale);
+
+	/** Part of a rendered view rect that covers the display FOV. */
+	static FIntRect GetDisplayRect(const FIntRect& ViewRect, float Scale);
+
+	/**
+	 * Crops every overscanned view of a view family back to its display FOV, in place.
+	 *
+	 * @param ViewFamily Views to crop; views rendered without overscan are left untouched.
+	 * @param ViewFamilyTexture View family output, after any warp.
+	 */
+	void AddCropPasses_RenderThread(FRDGBuilder& GraphBuilder, const FSceneViewFamily& ViewFamily, FRDGTextureRef ViewFamilyTexture) const;
+
+private:
+	FAsyncReprojectionOverscan() = default;
+
+	/**
+	 * @struct FSlotMargin
+	 *
+	 * Game-thread margin of one view slot. The margin opens as soon as the camera turns faster and closes over
+	 * ReleaseSeconds once it slows down, so it does not pump with every frame's speed.
+	 */
+	struct FSlotMargin
+	{
+		float MarginDegrees = 0.0f;
+		float PublishedScale = 1.0f;
+		double LastUpdateSeconds = 0.0;
+	};
+
+	void PublishScale_GameThread(int32 ViewSlotIndex, FSlotMargin& Slot, float Scale);
+
+	/** Game thread only. */
+	TMap<int32, FSlotMargin> SlotMargins;
+
+	/** Owned by the rendering thread. */
+	TMap<int32, float> ScaleByViewSlot;
+};
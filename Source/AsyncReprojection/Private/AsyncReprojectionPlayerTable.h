@@ -0,0 +1,67 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+#include <atomic>
+
+/**
+ * @class TAsyncReprojectionPlayerTable
+ *
+ * Index-addressed per-local-player state. Each entry is a separate cache-line-aligned allocation, so one player's hot
+ * atomics never share a line with another player's. Lookups are a bounds check and an array load.
+ * The table has a fixed capacity and only grows: entries are built before the entry count is published with release
+ * ordering and are never moved or freed, so any thread (rendering, RHI, compositor) reads them without a lock.
+ */
+template<typename TPlayerState>
+class TAsyncReprojectionPlayerTable
+{
+	static_assert(alignof(TPlayerState) >= PLATFORM_CACHE_LINE_SIZE, "Per-player state must be cache-line aligned to avoid false sharing between players.");
+
+public:
+	/** Local players plus stereo eyes never come close; indices beyond it have no state. */
+	static constexpr int32 MaxNum = 16;
+
+	explicit TAsyncReprojectionPlayerTable(int32 InitialNum)
+	{
+		Grow_GameThread(InitialNum);
+	}
+
+	int32 Num() const
+	{
+		return NumEntries.load(std::memory_order_acquire);
+	}
+
+	TPlayerState* Find(int32 PlayerIndex)
+	{
+		return PlayerIndex >= 0 && PlayerIndex < Num() ? Entries[PlayerIndex].Get() : nullptr;
+	}
+
+	const TPlayerState* Find(int32 PlayerIndex) const
+	{
+		return PlayerIndex >= 0 && PlayerIndex < Num() ? Entries[PlayerIndex].Get() : nullptr;
+	}
+
+	/** Grows the table to at least NumPlayers entries, up to MaxNum. Game thread only. */
+	void Grow_GameThread(int32 NumPlayers)
+	{
+		const int32 OldNum = NumEntries.load(std::memory_order_relaxed);
+		const int32 NewNum = FMath::Min(NumPlayers, MaxNum);
+		if (NewNum <= OldNum)
+		{
+			return;
+		}
+
+		for (int32 Index = OldNum; Index < NewNum; Index++)
+		{
+			Entries[Index] = MakeUnique<TPlayerState>();
+		}
+		NumEntries.store(NewNum, std::memory_order_release);
+	}
+
+private:
+	TUniquePtr<TPlayerState> Entries[MaxNum];
+	std::atomic<int32> NumEntries { 0 };
+};
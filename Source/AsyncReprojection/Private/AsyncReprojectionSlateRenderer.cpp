@@ -134,6 +134,7 @@ void FAsyncReprojectionSlateRenderer::Destroy()
 
 void FAsyncReprojectionSlateRenderer::CreateViewport(const TSharedRef<SWindow> InWindow)
 {
+	bViewportCacheDirty = true;
 	UnderlyingRenderer->CreateViewport(InWindow);
 }
 
@@ -161,43 +162,25 @@ void FAsyncReprojectionSlateRenderer::DrawWindows(FSlateDrawBuffer& InWindowDraw
 {
 	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
 	const bool bAsyncPipelineEnabled = CVarState.bAsyncPresent || CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
-	const bool bDoAsyncPresent = bAsyncPipelineEnabled && CVarState.bAsyncPresentAllowHUDStable && FAsyncReprojectionAsyncPresent::Get().ShouldSkipWorldRendering();
+	// Foreground-only frames warp inside the view family, so the back buffer already holds the world when Slate draws.
+	const bool bDoAsyncPresent = bAsyncPipelineEnabled
+		&& CVarState.bAsyncPresentAllowHUDStable
+		&& FAsyncReprojectionAsyncPresent::Get().ShouldSkipWorldRendering()
+		&& !FAsyncReprojectionAsyncPresent::Get().IsForegroundOnlyFrame();
 
 	if (bDoAsyncPresent)
 	{
-		TArray<FRHIViewport*, TInlineAllocator<4>> ViewportsToPrep;
-		for (const TSharedRef<FSlateWindowElementList>& ElementList : InWindowDrawBuffer.GetWindowElementLists())
+		if (bViewportCacheDirty || !IsViewportCacheCurrent(InWindowDrawBuffer))
 		{
-			SWindow* Window = ElementList->GetRenderWindow();
-			if (Window == nullptr)
-			{
-				continue;
-			}
-
-			void* ViewportResource = UnderlyingRenderer->GetViewportResource(*Window);
-			if (ViewportResource == nullptr)
-			{
-				continue;
-			}
-
-			FViewportRHIRef* ViewportRefPtr = static_cast<FViewportRHIRef*>(ViewportResource);
-			if (ViewportRefPtr == nullptr || !ViewportRefPtr->IsValid())
-			{
-				continue;
-			}
-
-			ViewportsToPrep.Add(ViewportRefPtr->GetReference());
+			RebuildViewportCache(InWindowDrawBuffer);
 		}
 
-		if (!ViewportsToPrep.IsEmpty())
+		if (CachedViewports.IsValid())
 		{
 			ENQUEUE_RENDER_COMMAND(AsyncReprojectionPreSlateCachedWarp)(
-				[ViewportsToPrep](FRHICommandListImmediate& RHICmdList)
+				[Viewports = CachedViewports](FRHICommandListImmediate& RHICmdList)
 				{
-					for (FRHIViewport* ViewportRHI : ViewportsToPrep)
-					{
-						FAsyncReprojectionCachedPresentWarp::AddPreSlatePassIfEnabled(RHICmdList, ViewportRHI);
-					}
+					FAsyncReprojectionCachedPresentWarp::AddPreSlatePassesIfEnabled(RHICmdList, *Viewports);
 				});
 		}
 	}
@@ -205,6 +188,64 @@ void FAsyncReprojectionSlateRenderer::DrawWindows(FSlateDrawBuffer& InWindowDraw
 	UnderlyingRenderer->DrawWindows(InWindowDrawBuffer);
 }
 
+bool FAsyncReprojectionSlateRenderer::IsViewportCacheCurrent(FSlateDrawBuffer& InWindowDrawBuffer) const
+{
+	const TArray<TSharedRef<FSlateWindowElementList>>& ElementLists = InWindowDrawBuffer.GetWindowElementLists();
+	if (ElementLists.Num() != CachedWindows.Num())
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < ElementLists.Num(); ++Index)
+	{
+		if (ElementLists[Index]->GetRenderWindow() != CachedWindows[Index])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FAsyncReprojectionSlateRenderer::RebuildViewportCache(FSlateDrawBuffer& InWindowDrawBuffer)
+{
+	CachedWindows.Reset();
+	TSharedRef<FPreSlateViewportList, ESPMode::ThreadSafe> Viewports = MakeShared<FPreSlateViewportList, ESPMode::ThreadSafe>();
+
+	for (const TSharedRef<FSlateWindowElementList>& ElementList : InWindowDrawBuffer.GetWindowElementLists())
+	{
+		SWindow* Window = ElementList->GetRenderWindow();
+		CachedWindows.Add(Window);
+		if (Window == nullptr)
+		{
+			continue;
+		}
+
+		void* ViewportResource = UnderlyingRenderer->GetViewportResource(*Window);
+		if (ViewportResource == nullptr)
+		{
+			continue;
+		}
+
+		FViewportRHIRef* ViewportRefPtr = static_cast<FViewportRHIRef*>(ViewportResource);
+		if (ViewportRefPtr == nullptr || !ViewportRefPtr->IsValid())
+		{
+			continue;
+		}
+
+		Viewports->Add(ViewportRefPtr->GetReference());
+	}
+
+	// In-flight render commands keep the previous list alive; it is replaced rather than edited in place.
+	CachedViewports.Reset();
+	if (!Viewports->IsEmpty())
+	{
+		CachedViewports = Viewports;
+	}
+
+	bViewportCacheDirty = false;
+}
+
 void FAsyncReprojectionSlateRenderer::SetColorVisionDeficiencyType(EColorVisionDeficiency Type, int32 Severity, bool bCorrectDeficiency, bool bShowCorrectionWithDeficiency)
 {
 	UnderlyingRenderer->SetColorVisionDeficiencyType(Type, Severity, bCorrectDeficiency, bShowCorrectionWithDeficiency);
@@ -259,6 +300,7 @@ void FAsyncReprojectionSlateRenderer::ReleaseDynamicResource(const FSlateBrush&
 
 void FAsyncReprojectionSlateRenderer::OnWindowDestroyed(const TSharedRef<SWindow>& InWindow)
 {
+	bViewportCacheDirty = true;
 	UnderlyingRenderer->OnWindowDestroyed(InWindow);
 }
 
@@ -11,6 +11,8 @@
 #define UE_VERSION_AT_LEAST(MajorVersion, MinorVersion, PatchVersion) UE_VERSION_NEWER_THAN_OR_EQUAL(MajorVersion, MinorVersion, PatchVersion)
 #endif
 
+class FRHIViewport;
+
 /**
  * @class FAsyncReprojectionSlateRenderer
  *
@@ -104,14 +106,20 @@ public:
 
 	void OnSlateWindowDestroyedThunk(void* Ptr)
 	{
+		bViewportCacheDirty = true;
 		OnSlateWindowDestroyedDelegate.Broadcast(Ptr);
 	}
 
 	void OnPreResizeWindowBackBufferThunk(void* Ptr)
 	{
+		bViewportCacheDirty = true;
 		PreResizeBackBufferDelegate.Broadcast(Ptr);
 	}
 
+	/** Whether the draw buffer renders the same windows, in the same order, as the cached viewport list was built from. */
+	bool IsViewportCacheCurrent(FSlateDrawBuffer& InWindowDrawBuffer) const;
+	void RebuildViewportCache(FSlateDrawBuffer& InWindowDrawBuffer);
+
 	void OnPostResizeWindowBackBufferThunk(void* Ptr)
 	{
 		PostResizeBackBufferDelegate.Broadcast(Ptr);
@@ -129,6 +137,16 @@ public:
 
 	TSharedRef<FSlateRenderer> UnderlyingRenderer;
 
+	using FPreSlateViewportList = TArray<FRHIViewport*, TInlineAllocator<4>>;
+
+	/**
+	 * Game-thread cache of the viewports the pre-Slate warp runs on, so steady-state presents skip the viewport resource
+	 * lookups. Rebuilt when the rendered window set changes or a window's viewport is created, resized or destroyed.
+	 */
+	TArray<const SWindow*, TInlineAllocator<4>> CachedWindows;
+	TSharedPtr<const FPreSlateViewportList, ESPMode::ThreadSafe> CachedViewports;
+	bool bViewportCacheDirty = true;
+
 	FDelegateHandle OnSlateWindowRenderedHandle;
 	FDelegateHandle OnSlateWindowDestroyedHandle;
 	FDelegateHandle OnPreResizeWindowBackBufferHandle;
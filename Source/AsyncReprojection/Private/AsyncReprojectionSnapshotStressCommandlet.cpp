@@ -0,0 +1,338 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#include "AsyncReprojectionSnapshotStressCommandlet.h"
+
+#include "AsyncReprojection.h"
+#include "AsyncReprojectionSnapshotChannel.h"
+
+#include "Async/Async.h"
+#include "Dom/JsonObject.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#include <atomic>
+
+namespace AsyncReprojectionSnapshotStressPrivate
+{
+	static constexpr int32 JsonVersion = 1;
+	static constexpr double DefaultSeconds = 2.0;
+	static constexpr int32 MaxDefaultReaders = 8;
+	static constexpr int32 OpsPerTimingBatch = 256;
+
+	/**
+	 * @struct FStressPayload
+	 *
+	 * Roughly the size of a rendered-view snapshot. Every field but PublishCycles is derived from Stamp, so a copy that
+	 * mixes two publishes fails IsConsistent.
+	 */
+	struct FStressPayload
+	{
+		uint64 Stamp = 0;
+		uint64 PublishCycles = 0;
+		FQuat Rotation = FQuat::Identity;
+		FVector Location = FVector::ZeroVector;
+		FMatrix44f ViewToClip = FMatrix44f::Identity;
+		FMatrix44f ClipToView = FMatrix44f::Identity;
+		uint64 StampComplement = ~uint64(0);
+
+		static FStressPayload Make(uint64 Stamp, uint64 PublishCycles)
+		{
+			const double Value = double(Stamp);
+			const float MatrixValue = float(Stamp & 0xFFFFFFu);
+
+			FStressPayload Payload;
+			Payload.Stamp = Stamp;
+			Payload.PublishCycles = PublishCycles;
+			Payload.Rotation = FQuat(Value, Value, Value, Value);
+			Payload.Location = FVector(Value);
+			for (int32 Row = 0; Row < 4; Row++)
+			{
+				for (int32 Column = 0; Column < 4; Column++)
+				{
+					Payload.ViewToClip.M[Row][Column] = MatrixValue;
+					Payload.ClipToView.M[Row][Column] = MatrixValue;
+				}
+			}
+			Payload.StampComplement = ~Stamp;
+			return Payload;
+		}
+
+		bool IsConsistent() const
+		{
+			const double Value = double(Stamp);
+			const float MatrixValue = float(Stamp & 0xFFFFFFu);
+
+			bool bConsistent = StampComplement == ~Stamp
+				&& Rotation.X == Value && Rotation.Y == Value && Rotation.Z == Value && Rotation.W == Value
+				&& Location.X == Value && Location.Y == Value && Location.Z == Value;
+			for (int32 Row = 0; Row < 4; Row++)
+			{
+				for (int32 Column = 0; Column < 4; Column++)
+				{
+					bConsistent &= ViewToClip.M[Row][Column] == MatrixValue && ClipToView.M[Row][Column] == MatrixValue;
+				}
+			}
+			return bConsistent;
+		}
+	};
+
+	/** The two-slot WriteIndex buffer the camera tracker used before TAsyncReprojectionSnapshotChannel. */
+	struct FTwoSlotBuffer
+	{
+		std::atomic<uint32> WriteIndex { 0 };
+		FStressPayload Snapshots[2];
+
+		void Publish(const FStressPayload& Payload, uint64 /*FrameCounter*/, double /*TimeSeconds*/)
+		{
+			const uint32 NextIndex = (WriteIndex.load(std::memory_order_relaxed) + 1u) & 1u;
+			Snapshots[NextIndex] = Payload;
+			WriteIndex.store(NextIndex, std::memory_order_seq_cst);
+		}
+
+		FStressPayload Read() const
+		{
+			return Snapshots[WriteIndex.load(std::memory_order_relaxed) & 1u];
+		}
+	};
+
+	/**
+	 * @struct FReaderCounters
+	 *
+	 * Totals of one reader thread, merged after the run.
+	 */
+	struct FReaderCounters
+	{
+		uint64 Reads = 0;
+		uint64 TornReads = 0;
+		uint64 ReadCycles = 0;
+		uint64 LatencySamples = 0;
+		uint64 LatencyCycles = 0;
+		uint64 MaxLatencyCycles = 0;
+	};
+
+	struct FStressResult
+	{
+		const TCHAR* Channel = TEXT("");
+		int32 NumReaders = 0;
+		double Seconds = 0.0;
+		uint64 Publishes = 0;
+		uint64 Reads = 0;
+		uint64 TornReads = 0;
+		double PublishNs = 0.0;
+		double ReadNs = 0.0;
+		double MeanLatencyUs = 0.0;
+		double MaxLatencyUs = 0.0;
+	};
+
+	/**
+	 * Publishes back to back from one thread while NumReaders threads read, each timing batches of OpsPerTimingBatch
+	 * operations. After each read batch a reader samples the age of the newest visible publish, outside the timed batch.
+	 */
+	template<typename TChannel>
+	static FStressResult RunStress(const TCHAR* Name, int32 NumReaders, double Seconds)
+	{
+		TChannel Channel;
+		std::atomic<bool> bStart { false };
+		std::atomic<bool> bStop { false };
+
+		uint64 Publishes = 0;
+		uint64 PublishCycles = 0;
+		TFuture<void> Writer = Async(EAsyncExecution::Thread, [&Channel, &bStart, &bStop, &Publishes, &PublishCycles]()
+		{
+			while (!bStart.load(std::memory_order_acquire))
+			{
+				FPlatformProcess::YieldThread();
+			}
+
+			uint64 Stamp = 0;
+			while (!bStop.load(std::memory_order_relaxed))
+			{
+				const uint64 BatchStart = FPlatformTime::Cycles64();
+				for (int32 Op = 0; Op < OpsPerTimingBatch; Op++)
+				{
+					Stamp++;
+					Channel.Publish(FStressPayload::Make(Stamp, FPlatformTime::Cycles64()), Stamp, 0.0);
+				}
+				PublishCycles += FPlatformTime::Cycles64() - BatchStart;
+				Publishes += OpsPerTimingBatch;
+			}
+		});
+
+		TArray<FReaderCounters> Counters;
+		Counters.SetNum(NumReaders);
+		TArray<TFuture<void>> Readers;
+		for (int32 ReaderIndex = 0; ReaderIndex < NumReaders; ReaderIndex++)
+		{
+			FReaderCounters& Reader = Counters[ReaderIndex];
+			Readers.Add(Async(EAsyncExecution::Thread, [&Channel, &bStart, &bStop, &Reader]()
+			{
+				while (!bStart.load(std::memory_order_acquire))
+				{
+					FPlatformProcess::YieldThread();
+				}
+
+				while (!bStop.load(std::memory_order_relaxed))
+				{
+					const uint64 BatchStart = FPlatformTime::Cycles64();
+					for (int32 Op = 0; Op < OpsPerTimingBatch; Op++)
+					{
+						const FStressPayload Payload = Channel.Read();
+						Reader.TornReads += Payload.IsConsistent() ? 0 : 1;
+					}
+					Reader.ReadCycles += FPlatformTime::Cycles64() - BatchStart;
+					Reader.Reads += OpsPerTimingBatch;
+
+					const FStressPayload Latest = Channel.Read();
+					const uint64 NowCycles = FPlatformTime::Cycles64();
+					if (Latest.IsConsistent() && Latest.Stamp != 0 && NowCycles >= Latest.PublishCycles)
+					{
+						const uint64 LatencyCycles = NowCycles - Latest.PublishCycles;
+						Reader.LatencySamples++;
+						Reader.LatencyCycles += LatencyCycles;
+						Reader.MaxLatencyCycles = FMath::Max(Reader.MaxLatencyCycles, LatencyCycles);
+					}
+				}
+			}));
+		}
+
+		bStart.store(true, std::memory_order_release);
+		FPlatformProcess::Sleep(float(Seconds));
+		bStop.store(true, std::memory_order_relaxed);
+
+		Writer.Wait();
+		for (TFuture<void>& Reader : Readers)
+		{
+			Reader.Wait();
+		}
+
+		FReaderCounters Total;
+		for (const FReaderCounters& Reader : Counters)
+		{
+			Total.Reads += Reader.Reads;
+			Total.TornReads += Reader.TornReads;
+			Total.ReadCycles += Reader.ReadCycles;
+			Total.LatencySamples += Reader.LatencySamples;
+			Total.LatencyCycles += Reader.LatencyCycles;
+			Total.MaxLatencyCycles = FMath::Max(Total.MaxLatencyCycles, Reader.MaxLatencyCycles);
+		}
+
+		const double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+
+		FStressResult Result;
+		Result.Channel = Name;
+		Result.NumReaders = NumReaders;
+		Result.Seconds = Seconds;
+		Result.Publishes = Publishes;
+		Result.Reads = Total.Reads;
+		Result.TornReads = Total.TornReads;
+		Result.PublishNs = Publishes > 0 ? double(PublishCycles) * SecondsPerCycle * 1.0e9 / double(Publishes) : 0.0;
+		Result.ReadNs = Total.Reads > 0 ? double(Total.ReadCycles) * SecondsPerCycle * 1.0e9 / double(Total.Reads) : 0.0;
+		Result.MeanLatencyUs = Total.LatencySamples > 0 ? double(Total.LatencyCycles) * SecondsPerCycle * 1.0e6 / double(Total.LatencySamples) : 0.0;
+		Result.MaxLatencyUs = double(Total.MaxLatencyCycles) * SecondsPerCycle * 1.0e6;
+		return Result;
+	}
+
+	static TSharedRef<FJsonObject> ToJson(const FStressResult& Result)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("Channel"), Result.Channel);
+		Object->SetNumberField(TEXT("Readers"), Result.NumReaders);
+		Object->SetNumberField(TEXT("Seconds"), Result.Seconds);
+		Object->SetNumberField(TEXT("Publishes"), double(Result.Publishes));
+		Object->SetNumberField(TEXT("Reads"), double(Result.Reads));
+		Object->SetNumberField(TEXT("TornReads"), double(Result.TornReads));
+		Object->SetNumberField(TEXT("PublishNs"), Result.PublishNs);
+		Object->SetNumberField(TEXT("ReadNs"), Result.ReadNs);
+		Object->SetNumberField(TEXT("MeanLatencyUs"), Result.MeanLatencyUs);
+		Object->SetNumberField(TEXT("MaxLatencyUs"), Result.MaxLatencyUs);
+		return Object;
+	}
+
+	static TSharedRef<FJsonObject> MakeEnvironmentJson()
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+		Object->SetStringField(TEXT("BuildConfiguration"), LexToString(FApp::GetBuildConfiguration()));
+		Object->SetStringField(TEXT("Platform"), FPlatformProperties::PlatformName());
+		Object->SetStringField(TEXT("CPU"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+		Object->SetNumberField(TEXT("CPUCores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+		return Object;
+	}
+}
+
+UAsyncReprojectionSnapshotStressCommandlet::UAsyncReprojectionSnapshotStressCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAsyncReprojectionSnapshotStressCommandlet::Main(const FString& Params)
+{
+	using namespace AsyncReprojectionSnapshotStressPrivate;
+
+	double Seconds = DefaultSeconds;
+	int32 NumReaders = FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads() - 1, 1, MaxDefaultReaders);
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AsyncReprojection"), TEXT("SnapshotStress.json"));
+	FParse::Value(*Params, TEXT("Seconds="), Seconds);
+	FParse::Value(*Params, TEXT("Readers="), NumReaders);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	Seconds = FMath::Max(0.1, Seconds);
+	NumReaders = FMath::Max(1, NumReaders);
+
+	const FStressResult Results[] =
+	{
+		RunStress<TAsyncReprojectionSnapshotChannel<FStressPayload>>(TEXT("SnapshotChannel"), NumReaders, Seconds),
+		RunStress<FTwoSlotBuffer>(TEXT("TwoSlotBuffer"), NumReaders, Seconds),
+	};
+
+	TArray<TSharedPtr<FJsonValue>> ResultValues;
+	for (const FStressResult& Result : Results)
+	{
+		UE_LOG(
+			LogAsyncReprojection,
+			Display,
+			TEXT("SnapshotStress %s: Readers=%d Publishes=%llu Reads=%llu TornReads=%llu Publish=%.1fns Read=%.1fns Latency=%.2fus (max %.2fus)"),
+			Result.Channel,
+			Result.NumReaders,
+			Result.Publishes,
+			Result.Reads,
+			Result.TornReads,
+			Result.PublishNs,
+			Result.ReadNs,
+			Result.MeanLatencyUs,
+			Result.MaxLatencyUs);
+
+		ResultValues.Add(MakeShared<FJsonValueObject>(ToJson(Result)));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("Version"), JsonVersion);
+	Root->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+	Root->SetObjectField(TEXT("Environment"), MakeEnvironmentJson());
+	Root->SetArrayField(TEXT("Results"), ResultValues);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	if (!FJsonSerializer::Serialize(Root, Writer) || !FFileHelper::SaveStringToFile(Json, *OutputPath))
+	{
+		UE_LOG(LogAsyncReprojection, Error, TEXT("SnapshotStress: failed to write %s."), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogAsyncReprojection, Display, TEXT("SnapshotStress: wrote %s."), *OutputPath);
+
+	// Torn reads of the legacy buffer are expected and only reported; the channel must never return one.
+	if (Results[0].TornReads != 0)
+	{
+		UE_LOG(LogAsyncReprojection, Error, TEXT("SnapshotStress: the snapshot channel returned %llu torn reads."), Results[0].TornReads);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,29 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "AsyncReprojectionSnapshotStressCommandlet.generated.h"
+
+/**
+ * @class UAsyncReprojectionSnapshotStressCommandlet
+ *
+ * Hammers TAsyncReprojectionSnapshotChannel with one writer publishing back to back and several concurrent readers,
+ * verifies that no read returns a mix of two publishes, and measures publish cost, read cost and publish-to-read
+ * latency. The two-slot WriteIndex buffer the channel replaced runs the same load for comparison. Results are written
+ * as JSON; the commandlet fails if the channel returns a torn read.
+ *
+ * Usage: -run=AsyncReprojectionSnapshotStress [-Seconds=2] [-Readers=<cores - 1, max 8>] [-Output=<path>]
+ */
+UCLASS()
+class UAsyncReprojectionSnapshotStressCommandlet final : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAsyncReprojectionSnapshotStressCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,22 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("AsyncReprojection"), STATGROUP_AsyncReprojection, STATCAT_Advanced);
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Frame Cache Memory"), STAT_AsyncReprojectionFrameCacheMemory, STATGROUP_AsyncReprojection, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Capture Traffic Per Frame"), STAT_AsyncReprojectionCaptureTraffic, STATGROUP_AsyncReprojection, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Warp Traffic Per Present"), STAT_AsyncReprojectionWarpTraffic, STATGROUP_AsyncReprojection, );
+
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Warp Rotation-Only Fallback %"), STAT_AsyncReprojectionWarpRotationOnlyFallback, STATGROUP_AsyncReprojection, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Warp Out-Of-Bounds %"), STAT_AsyncReprojectionWarpOutOfBounds, STATGROUP_AsyncReprojection, );
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Warp Occlusion Fallback %"), STAT_AsyncReprojectionWarpOcclusionFallback, STATGROUP_AsyncReprojection, );
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Hitches Masked"), STAT_AsyncReprojectionHitchesMasked, STATGROUP_AsyncReprojection, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Hitch Time Masked (ms)"), STAT_AsyncReprojectionHitchTimeMasked, STATGROUP_AsyncReprojection, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Scene Capture Views Rendered"), STAT_AsyncReprojectionSceneCaptureViews, STATGROUP_AsyncReprojection, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Scene Captures Decimated"), STAT_AsyncReprojectionSceneCapturesDecimated, STATGROUP_AsyncReprojection, );
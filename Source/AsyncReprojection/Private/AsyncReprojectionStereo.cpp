@@ -0,0 +1,237 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#include "AsyncReprojectionStereo.h"
+
+#include "AsyncReprojection.h"
+#include "AsyncReprojectionCVars.h"
+
+#include "Engine/Engine.h"
+#include "RenderingThread.h"
+#include "SceneView.h"
+#include "StereoRendering.h"
+
+#if ASYNC_REPROJECTION_WITH_XR
+#include "IXRTrackingSystem.h"
+#endif
+
+namespace AsyncReprojectionStereoPrivate
+{
+	static constexpr uint64 VerboseLogFrameInterval = 120;
+	static uint64 LastMissingPoseWarnFrame = 0;
+
+	/**
+	 * @class FTrackingPoseSource
+	 *
+	 * Head pose from the engine's XR tracking system, moved into world space with the tracking-to-world transform the
+	 * game thread last published.
+	 */
+	class FTrackingPoseSource final : public IAsyncReprojectionStereoPoseSource
+	{
+	public:
+		virtual const TCHAR* GetName() const override
+		{
+			return TEXT("XRTracking");
+		}
+
+		virtual FAsyncReprojectionHeadPose GetLatestHeadPose_RenderThread(const FAsyncReprojectionCVarState& CVarState) const override
+		{
+			FAsyncReprojectionHeadPose Pose;
+#if ASYNC_REPROJECTION_WITH_XR
+			if (!XRSystem.IsValid())
+			{
+				return Pose;
+			}
+
+			FQuat TrackingRotation = FQuat::Identity;
+			FVector TrackingLocation = FVector::ZeroVector;
+			if (!XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, TrackingRotation, TrackingLocation))
+			{
+				return Pose;
+			}
+
+			const FTransform WorldPose = FTransform(TrackingRotation, TrackingLocation) * TrackingToWorld;
+			Pose.bIsValid = true;
+			Pose.Rotation = WorldPose.GetRotation();
+			Pose.Location = WorldPose.GetLocation();
+#endif
+			return Pose;
+		}
+
+#if ASYNC_REPROJECTION_WITH_XR
+		void SetTrackingState_RenderThread(TSharedPtr<IXRTrackingSystem, ESPMode::ThreadSafe> InXRSystem, const FTransform& InTrackingToWorld)
+		{
+			XRSystem = MoveTemp(InXRSystem);
+			TrackingToWorld = InTrackingToWorld;
+		}
+
+	private:
+		TSharedPtr<IXRTrackingSystem, ESPMode::ThreadSafe> XRSystem;
+		FTransform TrackingToWorld = FTransform::Identity;
+#endif
+	};
+
+	/**
+	 * @class FSimulatedPoseSource
+	 *
+	 * Deterministic head sway for validating the stereo path without an HMD (e.g. with r.EnableStereoEmulation).
+	 * Yaw and pitch oscillate out of phase so every warp direction is exercised.
+	 */
+	class FSimulatedPoseSource final : public IAsyncReprojectionStereoPoseSource
+	{
+	public:
+		virtual const TCHAR* GetName() const override
+		{
+			return TEXT("Simulated");
+		}
+
+		virtual FAsyncReprojectionHeadPose GetLatestHeadPose_RenderThread(const FAsyncReprojectionCVarState& CVarState) const override
+		{
+			const double Phase = 2.0 * UE_DOUBLE_PI * double(CVarState.StereoSimulatedFrequencyHz) * FPlatformTime::Seconds();
+			const double Amplitude = double(CVarState.StereoSimulatedAmplitudeDegrees);
+
+			FAsyncReprojectionHeadPose Pose;
+			Pose.bIsValid = true;
+			Pose.Rotation = FRotator(Amplitude * 0.5 * FMath::Cos(Phase), Amplitude * FMath::Sin(Phase), 0.0).Quaternion();
+			return Pose;
+		}
+	};
+}
+
+FAsyncReprojectionStereo& FAsyncReprojectionStereo::Get()
+{
+	static FAsyncReprojectionStereo Instance;
+	return Instance;
+}
+
+FAsyncReprojectionStereo::FAsyncReprojectionStereo()
+	: TrackingPoseSource(MakeUnique<AsyncReprojectionStereoPrivate::FTrackingPoseSource>())
+	, SimulatedPoseSource(MakeUnique<AsyncReprojectionStereoPrivate::FSimulatedPoseSource>())
+{
+}
+
+FAsyncReprojectionStereo::~FAsyncReprojectionStereo() = default;
+
+bool FAsyncReprojectionStereo::IsStereoEyeView(const FSceneView& View)
+{
+	return IStereoRendering::IsStereoEyeView(View);
+}
+
+int32 FAsyncReprojectionStereo::GetViewSlotIndex(const FSceneView& View)
+{
+	if (IsStereoEyeView(View))
+	{
+		return FMath::Clamp(View.StereoViewIndex, 0, NumEyes - 1);
+	}
+
+	return View.PlayerIndex;
+}
+
+void FAsyncReprojectionStereo::Update_GameThread(const FAsyncReprojectionCVarState& CVarState)
+{
+	check(IsInGameThread());
+
+	const bool bStereoRendering = GEngine != nullptr && GEngine->StereoRenderingDevice.IsValid() && GEngine->StereoRenderingDevice->IsStereoEnabled();
+	const bool bActive = CVarState.bStereo && bStereoRendering;
+	if (bStereoActive.exchange(bActive, std::memory_order_relaxed) != bActive)
+	{
+		UE_LOG(LogAsyncReprojection, Log, TEXT("Stereo reprojection %s."), bActive ? TEXT("active") : TEXT("inactive"));
+	}
+
+#if ASYNC_REPROJECTION_WITH_XR
+	if (bActive)
+	{
+		TSharedPtr<IXRTrackingSystem, ESPMode::ThreadSafe> XRSystem = GEngine->XRSystem;
+		const FTransform TrackingToWorld = XRSystem.IsValid() ? XRSystem->GetTrackingToWorldTransform() : FTransform::Identity;
+		AsyncReprojectionStereoPrivate::FTrackingPoseSource* PoseSource = TrackingPoseSource.Get();
+		ENQUEUE_RENDER_COMMAND(AsyncReprojectionStereoTrackingState)(
+			[PoseSource, XRSystem, TrackingToWorld](FRHICommandListImmediate& RHICmdList)
+			{
+				PoseSource->SetTrackingState_RenderThread(XRSystem, TrackingToWorld);
+			});
+	}
+#endif
+}
+
+bool FAsyncReprojectionStereo::IsStereoActive_AnyThread() const
+{
+	return bStereoActive.load(std::memory_order_relaxed);
+}
+
+void FAsyncReprojectionStereo::SetPoseSourceOverride_GameThread(TSharedPtr<IAsyncReprojectionStereoPoseSource, ESPMode::ThreadSafe> PoseSource)
+{
+	check(IsInGameThread());
+
+	UE_LOG(LogAsyncReprojection, Log, TEXT("Stereo pose source override %s."), PoseSource.IsValid() ? PoseSource->GetName() : TEXT("cleared"));
+	ENQUEUE_RENDER_COMMAND(AsyncReprojectionStereoPoseSourceOverride)(
+		[this, PoseSource = MoveTemp(PoseSource)](FRHICommandListImmediate& RHICmdList) mutable
+		{
+			OverridePoseSource = MoveTemp(PoseSource);
+		});
+}
+
+void FAsyncReprojectionStereo::LatchRenderedHeadPose_RenderThread(const FAsyncReprojectionCVarState& CVarState)
+{
+	if (RenderedHeadFrameCounter == GFrameCounterRenderThread)
+	{
+		return;
+	}
+
+	RenderedHeadFrameCounter = GFrameCounterRenderThread;
+	RenderedHeadPose = GetLatestHeadPose_RenderThread(CVarState);
+}
+
+FAsyncReprojectionHeadPose FAsyncReprojectionStereo::GetRenderedHeadPose_RenderThread() const
+{
+	return RenderedHeadPose;
+}
+
+FAsyncReprojectionHeadPose FAsyncReprojectionStereo::GetLatestHeadPose_RenderThread(const FAsyncReprojectionCVarState& CVarState) const
+{
+	const IAsyncReprojectionStereoPoseSource& PoseSource = SelectPoseSource_RenderThread(CVarState);
+	const FAsyncReprojectionHeadPose Pose = PoseSource.GetLatestHeadPose_RenderThread(CVarState);
+	if (!Pose.bIsValid && (GFrameCounterRenderThread - AsyncReprojectionStereoPrivate::LastMissingPoseWarnFrame) >= AsyncReprojectionStereoPrivate::VerboseLogFrameInterval)
+	{
+		UE_LOG(LogAsyncReprojection, Warning, TEXT("Stereo pose source %s has no head pose; stereo eyes are not warped."), PoseSource.GetName());
+		AsyncReprojectionStereoPrivate::LastMissingPoseWarnFrame = GFrameCounterRenderThread;
+	}
+
+	return Pose;
+}
+
+FAsyncReprojectionCameraSnapshot FAsyncReprojectionStereo::ComputeLatestEyeCamera(
+	const FAsyncReprojectionHeadPose& RenderedHead,
+	const FAsyncReprojectionHeadPose& LatestHead,
+	const FQuat& RenderedEyeRotation,
+	const FVector& RenderedEyeLocation)
+{
+	FAsyncReprojectionCameraSnapshot Snapshot;
+	if (!RenderedHead.bIsValid || !LatestHead.bIsValid)
+	{
+		return Snapshot;
+	}
+
+	const FQuat HeadDeltaRotation = LatestHead.Rotation * RenderedHead.Rotation.Inverse();
+	const FVector EyeOffset = RenderedEyeLocation - RenderedHead.Location;
+
+	Snapshot.bIsValid = true;
+	Snapshot.TimeSeconds = FPlatformTime::Seconds();
+	Snapshot.CameraTransform = FTransform(
+		HeadDeltaRotation * RenderedEyeRotation,
+		LatestHead.Location + HeadDeltaRotation.RotateVector(EyeOffset));
+	return Snapshot;
+}
+
+const IAsyncReprojectionStereoPoseSource& FAsyncReprojectionStereo::SelectPoseSource_RenderThread(const FAsyncReprojectionCVarState& CVarState) const
+{
+	if (OverridePoseSource.IsValid())
+	{
+		return *OverridePoseSource;
+	}
+
+	if (CVarState.StereoPoseSource == 1)
+	{
+		return *SimulatedPoseSource;
+	}
+
+	return *TrackingPoseSource;
+}
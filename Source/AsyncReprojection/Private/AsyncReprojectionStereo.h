@@ -0,0 +1,108 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AsyncReprojectionCameraTracker.h"
+
+#include <atomic>
+
+class FSceneView;
+
+struct FAsyncReprojectionCVarState;
+
+namespace AsyncReprojectionStereoPrivate
+{
+	class FTrackingPoseSource;
+	class FSimulatedPoseSource;
+}
+
+/**
+ * @struct FAsyncReprojectionHeadPose
+ *
+ * World-space head pose reported by a stereo pose source.
+ */
+struct FAsyncReprojectionHeadPose
+{
+	bool bIsValid = false;
+	FQuat Rotation = FQuat::Identity;
+	FVector Location = FVector::ZeroVector;
+};
+
+/**
+ * @class IAsyncReprojectionStereoPoseSource
+ *
+ * Supplies the latest head pose for stereo reprojection. Queried on the rendering thread when a stereo view is
+ * rendered and again when its cached eyes are warped; only the head motion between those two queries is applied.
+ */
+class IAsyncReprojectionStereoPoseSource
+{
+public:
+	virtual ~IAsyncReprojectionStereoPoseSource() = default;
+
+	virtual const TCHAR* GetName() const = 0;
+	virtual FAsyncReprojectionHeadPose GetLatestHeadPose_RenderThread(const FAsyncReprojectionCVarState& CVarState) const = 0;
+};
+
+/**
+ * @class FAsyncReprojectionStereo
+ *
+ * Stereo support for the reprojection pipeline. Each eye of a stereo view family is cached in its own frame cache slot
+ * (the eye index stands in for the player index; stereo families have a single local player) and is warped by the head
+ * motion reported by the selected pose source since the eye was rendered.
+ */
+class FAsyncReprojectionStereo final
+{
+public:
+	static constexpr int32 NumEyes = 2;
+
+	static FAsyncReprojectionStereo& Get();
+
+	static bool IsStereoEyeView(const FSceneView& View);
+
+	/** Frame cache and tracker slot of a view: the eye index for stereo eye views, the local player index otherwise. */
+	static int32 GetViewSlotIndex(const FSceneView& View);
+
+	/** Publishes whether stereo rendering is active and hands game-thread XR state to the pose sources. */
+	void Update_GameThread(const FAsyncReprojectionCVarState& CVarState);
+	bool IsStereoActive_AnyThread() const;
+
+	/**
+	 * Replaces the built-in pose source selection, e.g. with a recorded or scripted HMD pose stream.
+	 *
+	 * @param PoseSource Source to query on the rendering thread, or nullptr to restore r.AsyncReprojection.Stereo.PoseSource.
+	 */
+	void SetPoseSourceOverride_GameThread(TSharedPtr<IAsyncReprojectionStereoPoseSource, ESPMode::ThreadSafe> PoseSource);
+
+	/** Records the head pose the current frame's eyes are rendered with; the first stereo view of a frame latches it. */
+	void LatchRenderedHeadPose_RenderThread(const FAsyncReprojectionCVarState& CVarState);
+	FAsyncReprojectionHeadPose GetRenderedHeadPose_RenderThread() const;
+	FAsyncReprojectionHeadPose GetLatestHeadPose_RenderThread(const FAsyncReprojectionCVarState& CVarState) const;
+
+	/**
+	 * Applies the head motion from RenderedHead to LatestHead to one eye's rendered camera, keeping the eye's offset
+	 * from the head rigid.
+	 */
+	static FAsyncReprojectionCameraSnapshot ComputeLatestEyeCamera(
+		const FAsyncReprojectionHeadPose& RenderedHead,
+		const FAsyncReprojectionHeadPose& LatestHead,
+		const FQuat& RenderedEyeRotation,
+		const FVector& RenderedEyeLocation);
+
+private:
+	FAsyncReprojectionStereo();
+	~FAsyncReprojectionStereo();
+
+	const IAsyncReprojectionStereoPoseSource& SelectPoseSource_RenderThread(const FAsyncReprojectionCVarState& CVarState) const;
+
+private:
+	TUniquePtr<AsyncReprojectionStereoPrivate::FTrackingPoseSource> TrackingPoseSource;
+	TUniquePtr<AsyncReprojectionStereoPrivate::FSimulatedPoseSource> SimulatedPoseSource;
+
+	/** Owned by the rendering thread. */
+	TSharedPtr<IAsyncReprojectionStereoPoseSource, ESPMode::ThreadSafe> OverridePoseSource;
+	FAsyncReprojectionHeadPose RenderedHeadPose;
+	uint64 RenderedHeadFrameCounter = 0;
+
+	std::atomic<bool> bStereoActive { false };
+};
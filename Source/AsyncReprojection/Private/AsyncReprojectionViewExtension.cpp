@@ -6,7 +6,11 @@
 #include "AsyncReprojectionCameraTracker.h"
 #include "AsyncReprojectionCVars.h"
 #include "AsyncReprojectionDebugOverlay.h"
+#include "AsyncReprojectionForeground.h"
 #include "AsyncReprojectionFrameCache.h"
+#include "AsyncReprojectionOverscan.h"
+#include "AsyncReprojectionStereo.h"
+#include "AsyncReprojectionViewScheduler.h"
 #include "AsyncReprojectionWarpPass.h"
 
 #include "PostProcess/PostProcessInputs.h"
@@ -40,19 +44,15 @@ static FQuat ComputeInputDrivenDeltaQuat(
 		return FQuat::Identity;
 	}
 
-	const float YawScale = CVarState.InputYawDegreesPerPixel;
-	const float PitchScale = CVarState.InputPitchDegreesPerPixel;
-	if (YawScale == 0.0f && PitchScale == 0.0f)
+	const FVector2f TurnDegrees = FAsyncReprojectionCameraTracker::Get().GetInputTotals_AnyThread(PlayerIndex).GetTurnDegreesSince(
+		RenderedViewSnapshot.InputTotals, CVarState.InputYawDegreesPerPixel, CVarState.InputPitchDegreesPerPixel);
+	if (TurnDegrees.IsNearlyZero())
 	{
 		return FQuat::Identity;
 	}
 
-	const FVector2f CurrentTotals = FAsyncReprojectionCameraTracker::Get().GetMouseTotals_RenderThread(PlayerIndex);
-	const float DeltaX = CurrentTotals.X - RenderedViewSnapshot.InputMouseXTotal;
-	const float DeltaY = CurrentTotals.Y - RenderedViewSnapshot.InputMouseYTotal;
-
-	const float YawDeg = DeltaX * YawScale;
-	const float PitchDeg = (-DeltaY) * PitchScale;
+	const float YawDeg = TurnDegrees.X;
+	const float PitchDeg = TurnDegrees.Y;
 
 	const FQuat YawQuat(FVector::UpVector, FMath::DegreesToRadians(YawDeg));
 	const FVector PitchAxis = RenderedRotation.RotateVector(FVector::RightVector);
@@ -61,6 +61,22 @@ static FQuat ComputeInputDrivenDeltaQuat(
 	return PitchQuat * YawQuat;
 }
 
+/** Latest camera for a view: head motion applied to the rendered eye for stereo eye views, the pose provider's otherwise. */
+static FAsyncReprojectionCameraSnapshot GetLatestCameraForView_RenderThread(const FAsyncReprojectionCVarState& CVarState, const FSceneView& View, int32 ViewSlotIndex)
+{
+	if (!FAsyncReprojectionStereo::IsStereoEyeView(View))
+	{
+		return FAsyncReprojectionCameraTracker::Get().GetLatestCamera_RenderThread(ViewSlotIndex, CVarState);
+	}
+
+	const FAsyncReprojectionStereo& Stereo = FAsyncReprojectionStereo::Get();
+	return FAsyncReprojectionStereo::ComputeLatestEyeCamera(
+		Stereo.GetRenderedHeadPose_RenderThread(),
+		Stereo.GetLatestHeadPose_RenderThread(CVarState),
+		View.ViewRotation.Quaternion(),
+		View.ViewLocation);
+}
+
 FAsyncReprojectionViewExtension::FAsyncReprojectionViewExtension(const FAutoRegister& AutoRegister, FAsyncReprojectionCameraTracker* InCameraTracker)
 	: FSceneViewExtensionBase(AutoRegister)
 	, CameraTracker(InCameraTracker)
@@ -77,26 +93,54 @@ void FAsyncReprojectionViewExtension::SetupViewFamily(FSceneViewFamily& InViewFa
 {
 }
 
+void FAsyncReprojectionViewExtension::SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView)
+{
+	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
+
+	FAsyncReprojectionViewScheduler::Get().NotifyView_GameThread(InView);
+
+	// The foreground layer first: a foreground-only view keeps its display projection.
+	FAsyncReprojectionForeground::Get().SetupView_GameThread(CVarState, InView);
+	FAsyncReprojectionOverscan::Get().SetupView_GameThread(CVarState, InViewFamily, InView);
+}
+
 void FAsyncReprojectionViewExtension::PreRenderView_RenderThread(FRDGBuilder& GraphBuilder, FSceneView& InView)
 {
-	if (!ShouldRunForView(InView))
+	// A foreground-only view is warped against the cached frame, so the last full frame stays the rendered view.
+	if (!ShouldRunForView(InView) || FAsyncReprojectionForeground::Get().IsForegroundView_RenderThread(InView))
 	{
 		return;
 	}
 
+	const int32 ViewSlotIndex = FAsyncReprojectionStereo::GetViewSlotIndex(InView);
+	if (FAsyncReprojectionStereo::IsStereoEyeView(InView))
+	{
+		FAsyncReprojectionStereo::Get().LatchRenderedHeadPose_RenderThread(FAsyncReprojectionCVars::Get());
+	}
+
 	FAsyncReprojectionRenderedViewSnapshot Snapshot;
 	Snapshot.bIsValid = true;
 	Snapshot.RenderedRotation = InView.ViewRotation.Quaternion();
 	Snapshot.RenderedLocation = InView.ViewLocation;
-	const FVector2f MouseTotals = FAsyncReprojectionCameraTracker::Get().GetMouseTotals_RenderThread(InView.PlayerIndex);
-	Snapshot.InputMouseXTotal = MouseTotals.X;
-	Snapshot.InputMouseYTotal = MouseTotals.Y;
-	Snapshot.ViewToClip = FMatrix44f(InView.ViewMatrices.GetProjectionMatrix());
-	Snapshot.ClipToView = FMatrix44f(InView.ViewMatrices.GetInvProjectionMatrix());
+	Snapshot.InputTotals = FAsyncReprojectionCameraTracker::Get().GetInputTotals_AnyThread(ViewSlotIndex);
+
+	// WarpAfterUI warps the back buffer, which shows the display FOV once an overscanned view has been cropped.
+	const float OverscanScale = FAsyncReprojectionOverscan::Get().GetScale_RenderThread(ViewSlotIndex);
+	if (OverscanScale > 1.0f)
+	{
+		const FMatrix DisplayProjection = FAsyncReprojectionOverscan::ScaleProjection(InView.ViewMatrices.GetProjectionMatrix(), 1.0f / OverscanScale);
+		Snapshot.ViewToClip = FMatrix44f(DisplayProjection);
+		Snapshot.ClipToView = FMatrix44f(DisplayProjection.Inverse());
+	}
+	else
+	{
+		Snapshot.ViewToClip = FMatrix44f(InView.ViewMatrices.GetProjectionMatrix());
+		Snapshot.ClipToView = FMatrix44f(InView.ViewMatrices.GetInvProjectionMatrix());
+	}
 	Snapshot.ViewRect = InView.UnscaledViewRect;
 	Snapshot.FeatureLevel = InView.GetFeatureLevel();
 
-	FAsyncReprojectionCameraTracker::Get().PublishRenderedView_RenderThread(InView.PlayerIndex, Snapshot);
+	FAsyncReprojectionCameraTracker::Get().PublishRenderedView_RenderThread(ViewSlotIndex, Snapshot);
 }
 
 void FAsyncReprojectionViewExtension::PrePostProcessPass_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& InView, const FPostProcessingInputs& Inputs)
@@ -104,7 +148,7 @@ void FAsyncReprojectionViewExtension::PrePostProcessPass_RenderThread(FRDGBuilde
 	(void)GraphBuilder;
 
 	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
-	if (CVarState.WarpPoint != EAsyncReprojectionWarpPoint::PostRenderViewFamily)
+	if (CVarState.WarpPoint != EAsyncReprojectionWarpPoint::PostRenderViewFamily && !CVarState.bOverscan && !CVarState.bForeground)
 	{
 		return;
 	}
@@ -123,7 +167,7 @@ void FAsyncReprojectionViewExtension::PrePostProcessPass_RenderThread(FRDGBuilde
 void FAsyncReprojectionViewExtension::PostRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily)
 {
 	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
-	if (CVarState.WarpPoint != EAsyncReprojectionWarpPoint::PostRenderViewFamily)
+	if (CVarState.WarpPoint != EAsyncReprojectionWarpPoint::PostRenderViewFamily && !CVarState.bOverscan && !CVarState.bForeground)
 	{
 		return;
 	}
@@ -143,6 +187,27 @@ void FAsyncReprojectionViewExtension::PostRenderViewFamily_RenderThread(FRDGBuil
 		return;
 	}
 
+	if (FAsyncReprojectionForeground::Get().IsForegroundViewFamily_RenderThread(InViewFamily))
+	{
+		// The world of a foreground-only family comes from the cached warp drawn under its foreground layer.
+		FAsyncReprojectionForeground::Get().AddCompositePasses_RenderThread(GraphBuilder, InViewFamily, CVarState, ViewFamilyTexture, SceneTexturesUB);
+	}
+	else if (CVarState.WarpPoint == EAsyncReprojectionWarpPoint::PostRenderViewFamily)
+	{
+		WarpViewFamily_RenderThread(GraphBuilder, InViewFamily, CVarState, ViewFamilyTexture, SceneTexturesUB);
+	}
+
+	// Cropping last keeps the guard band in every capture and warp above.
+	FAsyncReprojectionOverscan::Get().AddCropPasses_RenderThread(GraphBuilder, InViewFamily, ViewFamilyTexture);
+}
+
+void FAsyncReprojectionViewExtension::WarpViewFamily_RenderThread(
+	FRDGBuilder& GraphBuilder,
+	const FSceneViewFamily& InViewFamily,
+	const FAsyncReprojectionCVarState& CVarState,
+	FRDGTextureRef ViewFamilyTexture,
+	TRDGUniformBufferRef<FSceneTextureUniformParameters> SceneTexturesUB)
+{
 	const FRDGTextureDesc Desc = ViewFamilyTexture->Desc;
 
 	FRDGTextureRef Temp = GraphBuilder.CreateTexture(Desc, TEXT("AsyncReprojection.ViewFamilyTemp"));
@@ -161,6 +226,9 @@ void FAsyncReprojectionViewExtension::PostRenderViewFamily_RenderThread(FRDGBuil
 			continue;
 		}
 
+		// Display-resolution captures read the unwarped copy, so the warp below cannot feed back into the cache.
+		FAsyncReprojectionFrameCache::Get().UpdateAtDisplayResolution_RenderThread(GraphBuilder, View, Temp, SceneTexturesUB);
+
 		const FIntRect ViewRect = View.UnconstrainedViewRect.IsEmpty()
 			? FIntRect(FIntPoint::ZeroValue, Desc.Extent)
 			: View.UnconstrainedViewRect;
@@ -168,8 +236,8 @@ void FAsyncReprojectionViewExtension::PostRenderViewFamily_RenderThread(FRDGBuil
 		FScreenPassTexture Input(Temp, ViewRect);
 		FScreenPassRenderTarget Output(ViewFamilyTexture, ViewRect, ERenderTargetLoadAction::ELoad);
 
-		const int32 PlayerIndex = View.PlayerIndex;
-	const FAsyncReprojectionCameraSnapshot LatestCamera = FAsyncReprojectionCameraTracker::Get().GetLatestCamera(PlayerIndex);
+		const int32 PlayerIndex = FAsyncReprojectionStereo::GetViewSlotIndex(View);
+	const FAsyncReprojectionCameraSnapshot LatestCamera = GetLatestCameraForView_RenderThread(CVarState, View, PlayerIndex);
 	if (!LatestCamera.bIsValid)
 	{
 		if ((GFrameCounterRenderThread - AsyncReprojectionViewExtensionPrivate::LastMissingCameraWarnFrame) >= AsyncReprojectionViewExtensionPrivate::VerboseLogFrameInterval)
@@ -371,7 +439,7 @@ void FAsyncReprojectionViewExtension::SubscribeToPostProcessingPass(
 {
 	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
 	const bool bAsyncPipelineEnabled = CVarState.bAsyncPresent || CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
-	const bool bWantsAfterPassCallback = (CVarState.WarpPoint == EAsyncReprojectionWarpPoint::EndOfPostProcess) || bAsyncPipelineEnabled;
+	const bool bWantsAfterPassCallback = (CVarState.WarpPoint == EAsyncReprojectionWarpPoint::EndOfPostProcess) || bAsyncPipelineEnabled || CVarState.bHitchMask;
 	if (!bWantsAfterPassCallback)
 	{
 		return;
@@ -397,7 +465,7 @@ void FAsyncReprojectionViewExtension::SubscribeToPostProcessingPass(
 
 	if (bCandidate)
 	{
-		LastAfterPassByPlayer.Add(InView.PlayerIndex, Pass);
+		LastAfterPassByPlayer.Add(FAsyncReprojectionStereo::GetViewSlotIndex(InView), Pass);
 		InOutPassCallbacks.Add(FAfterPassCallbackDelegate::CreateRaw(this, &FAsyncReprojectionViewExtension::PostProcessPass_RenderThread, Pass));
 	}
 }
@@ -418,12 +486,13 @@ static const TCHAR* PostProcessPassToString(ISceneViewExtension::EPostProcessing
 FScreenPassTexture FAsyncReprojectionViewExtension::PostProcessPass_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessMaterialInputs& Inputs, EPostProcessingPass PassId)
 {
 	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
-	if (!ShouldRunForView(View))
+	// A foreground-only view is neither cached nor warped here; PostRenderViewFamily composites it over the cached warp.
+	if (!ShouldRunForView(View) || FAsyncReprojectionForeground::Get().IsForegroundView_RenderThread(View))
 	{
 		return Inputs.ReturnUntouchedSceneColorForPostProcessing(GraphBuilder);
 	}
 
-	const int32 PlayerIndex = View.PlayerIndex;
+	const int32 PlayerIndex = FAsyncReprojectionStereo::GetViewSlotIndex(View);
 	if (const EPostProcessingPass* LastPass = LastAfterPassByPlayer.Find(PlayerIndex))
 	{
 		if (*LastPass != PassId)
@@ -437,7 +506,8 @@ FScreenPassTexture FAsyncReprojectionViewExtension::PostProcessPass_RenderThread
 	}
 
 	const bool bAsyncPipelineEnabled = CVarState.bAsyncPresent || CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
-	if (bAsyncPipelineEnabled)
+	// Hitch masking presents from the cache even when nothing else does.
+	if (bAsyncPipelineEnabled || CVarState.bHitchMask)
 	{
 		FAsyncReprojectionFrameCache::Get().Update_RenderThread(GraphBuilder, View, Inputs);
 	}
@@ -481,7 +551,7 @@ FScreenPassTexture FAsyncReprojectionViewExtension::PostProcessPass_RenderThread
 		return ReturnWithOverlay(Overlay);
 	}
 
-	const FAsyncReprojectionCameraSnapshot LatestCamera = FAsyncReprojectionCameraTracker::Get().GetLatestCamera(PlayerIndex);
+	const FAsyncReprojectionCameraSnapshot LatestCamera = GetLatestCameraForView_RenderThread(CVarState, View, PlayerIndex);
 	if (!LatestCamera.bIsValid)
 	{
 		if ((GFrameCounterRenderThread - AsyncReprojectionViewExtensionPrivate::LastMissingCameraWarnFrame) >= AsyncReprojectionViewExtensionPrivate::VerboseLogFrameInterval)
@@ -693,6 +763,16 @@ bool FAsyncReprojectionViewExtension::ShouldRunForView(const FSceneView& View) c
 		return false;
 	}
 
+	if (FAsyncReprojectionStereo::IsStereoEyeView(View) && !CVarState.bStereo)
+	{
+		if ((GFrameCounterRenderThread - AsyncReprojectionViewExtensionPrivate::LastShouldRunSkipLogFrame) >= AsyncReprojectionViewExtensionPrivate::VerboseLogFrameInterval)
+		{
+			UE_LOG(LogAsyncReprojection, VeryVerbose, TEXT("ShouldRunForView=false: stereo eye view with r.AsyncReprojection.Stereo=0."));
+			AsyncReprojectionViewExtensionPrivate::LastShouldRunSkipLogFrame = GFrameCounterRenderThread;
+		}
+		return false;
+	}
+
 	if (!CVarState.bEnableInEditor)
 	{
 		if (GIsEditor)
@@ -7,12 +7,15 @@
 
 class FAsyncReprojectionCameraTracker;
 
+struct FAsyncReprojectionCVarState;
+
 class FAsyncReprojectionViewExtension final : public FSceneViewExtensionBase
 {
 public:
 	FAsyncReprojectionViewExtension(const FAutoRegister& AutoRegister, FAsyncReprojectionCameraTracker* InCameraTracker);
 
 	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override;
+	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override;
 	virtual void PreRenderView_RenderThread(FRDGBuilder& GraphBuilder, FSceneView& InView) override;
 	virtual void PrePostProcessPass_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& InView, const FPostProcessingInputs& Inputs) override;
 	virtual void PostRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily) override;
@@ -24,6 +27,14 @@ public:
 		bool bIsPassEnabled) override;
 
 private:
+	/** WarpPoint=PostRenderViewFamily: warps every view of the family in place. */
+	void WarpViewFamily_RenderThread(
+		FRDGBuilder& GraphBuilder,
+		const FSceneViewFamily& InViewFamily,
+		const FAsyncReprojectionCVarState& CVarState,
+		FRDGTextureRef ViewFamilyTexture,
+		TRDGUniformBufferRef<FSceneTextureUniformParameters> SceneTexturesUB);
+
 	FScreenPassTexture PostProcessPass_RenderThread(FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessMaterialInputs& Inputs, EPostProcessingPass PassId);
 
 	bool ShouldRunForView(const FSceneView& View) const;
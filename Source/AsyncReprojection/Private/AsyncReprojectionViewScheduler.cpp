@@ -0,0 +1,238 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#include "AsyncReprojectionViewScheduler.h"
+
+#include "AsyncReprojection.h"
+#include "AsyncReprojectionCVars.h"
+#include "AsyncReprojectionStats.h"
+
+#include "Components/SceneCaptureComponent.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Components/SceneCaptureComponentCube.h"
+#include "Engine/World.h"
+#include "SceneView.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_STAT(STAT_AsyncReprojectionSceneCaptureViews);
+DEFINE_STAT(STAT_AsyncReprojectionSceneCapturesDecimated);
+
+namespace AsyncReprojectionViewSchedulerPrivate
+{
+	static constexpr uint64 VerboseLogFrameInterval = 120;
+
+	/** Scene captures are created rarely, so the object iteration that finds them runs on this interval, not every frame. */
+	static constexpr double DiscoveryIntervalSeconds = 1.0;
+
+	/** Queues a capture for the end of the frame. Only 2D and cube captures are scheduled; planar reflections render with the world. */
+	static void CaptureSceneDeferred(USceneCaptureComponent* Component)
+	{
+		if (USceneCaptureComponent2D* Capture2D = Cast<USceneCaptureComponent2D>(Component))
+		{
+			Capture2D->CaptureSceneDeferred();
+		}
+		else if (USceneCaptureComponentCube* CaptureCube = Cast<USceneCaptureComponentCube>(Component))
+		{
+			CaptureCube->CaptureSceneDeferred();
+		}
+	}
+}
+
+FAsyncReprojectionViewScheduler& FAsyncReprojectionViewScheduler::Get()
+{
+	static FAsyncReprojectionViewScheduler Instance;
+	return Instance;
+}
+
+void FAsyncReprojectionViewScheduler::Shutdown()
+{
+	RestoreCaptures_GameThread();
+	ReleasedCaptures.Reset();
+	LastDiscoverySeconds = 0.0;
+}
+
+void FAsyncReprojectionViewScheduler::Tick_GameThread(const FAsyncReprojectionCVarState& CVarState, bool bWorldRendersThisFrame)
+{
+	using namespace AsyncReprojectionViewSchedulerPrivate;
+
+	check(IsInGameThread());
+
+	const bool bAsyncPipelineEnabled = CVarState.bAsyncPresent || CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
+	const bool bEnabled = CVarState.bSecondaryViews
+		&& bAsyncPipelineEnabled
+		&& CVarState.Mode != EAsyncReprojectionMode::Off
+		&& (!GIsEditor || CVarState.bEnableInEditor);
+	if (!bEnabled)
+	{
+		RestoreCaptures_GameThread();
+		return;
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	if ((NowSeconds - LastDiscoverySeconds) >= DiscoveryIntervalSeconds)
+	{
+		LastDiscoverySeconds = NowSeconds;
+		DiscoverCaptures_GameThread(CVarState, NowSeconds);
+	}
+
+	// With no rate of their own, captures follow the world: they render on the frames the game viewport renders.
+	const bool bOwnCadence = CVarState.SecondaryViewsTargetFPS > 0.0f;
+	const double PeriodSeconds = bOwnCadence ? 1.0 / double(CVarState.SecondaryViewsTargetFPS) : 0.0;
+
+	ScheduledCaptures.RemoveAllSwap([this](const FScheduledCapture& Scheduled)
+	{
+		USceneCaptureComponent* Component = Scheduled.Component.Get();
+		if (Component == nullptr || !Component->IsRegistered())
+		{
+			return true;
+		}
+
+		// The scheduler only ever writes false; game code that turned per-frame capturing back on owns the capture again.
+		if (Component->bCaptureEveryFrame)
+		{
+			Component->bCaptureOnMovement = Scheduled.bCaptureOnMovement;
+			ReleasedCaptures.Add(Component);
+			UE_LOG(LogAsyncReprojection, Log, TEXT("ViewScheduler released scene capture %s: game code re-enabled bCaptureEveryFrame."), *Component->GetPathName());
+			return true;
+		}
+		return false;
+	});
+
+	int32 NumIdle = 0;
+	TArray<int32, TInlineAllocator<16>> DueCaptures;
+	for (int32 Index = 0; Index < ScheduledCaptures.Num(); Index++)
+	{
+		FScheduledCapture& Scheduled = ScheduledCaptures[Index];
+
+		// Movement would queue captures of its own between the scheduled ones.
+		Scheduled.Component->bCaptureOnMovement = false;
+
+		if (!IsCaptureTicking(*Scheduled.Component))
+		{
+			NumIdle++;
+			continue;
+		}
+
+		const bool bDue = bOwnCadence
+			? (NowSeconds - Scheduled.LastCaptureSeconds) >= PeriodSeconds
+			: bWorldRendersThisFrame;
+		if (bDue)
+		{
+			DueCaptures.Add(Index);
+		}
+	}
+
+	// A frame that would render every capture at once spreads them out instead, longest-waiting first.
+	int32 NumToCapture = DueCaptures.Num();
+	if (CVarState.SecondaryViewsMaxCapturesPerFrame > 0 && NumToCapture > CVarState.SecondaryViewsMaxCapturesPerFrame)
+	{
+		DueCaptures.Sort([this](int32 A, int32 B)
+		{
+			return ScheduledCaptures[A].LastCaptureSeconds < ScheduledCaptures[B].LastCaptureSeconds;
+		});
+		NumToCapture = CVarState.SecondaryViewsMaxCapturesPerFrame;
+	}
+
+	for (int32 DueIndex = 0; DueIndex < NumToCapture; DueIndex++)
+	{
+		FScheduledCapture& Scheduled = ScheduledCaptures[DueCaptures[DueIndex]];
+		CaptureSceneDeferred(Scheduled.Component.Get());
+		Scheduled.LastCaptureSeconds = NowSeconds;
+	}
+
+	const int32 NumDecimated = ScheduledCaptures.Num() - NumIdle - NumToCapture;
+	SET_DWORD_STAT(STAT_AsyncReprojectionSceneCapturesDecimated, NumDecimated);
+
+	if ((GFrameCounter - LastVerboseLogFrame) >= VerboseLogFrameInterval)
+	{
+		UE_LOG(
+			LogAsyncReprojection,
+			Verbose,
+			TEXT("ViewScheduler tick: Scheduled=%d Idle=%d Captured=%d Decimated=%d WorldRenders=%d PeriodMs=%.2f"),
+			ScheduledCaptures.Num(),
+			NumIdle,
+			NumToCapture,
+			NumDecimated,
+			bWorldRendersThisFrame ? 1 : 0,
+			PeriodSeconds * 1000.0);
+		LastVerboseLogFrame = GFrameCounter;
+	}
+}
+
+void FAsyncReprojectionViewScheduler::NotifyView_GameThread(const FSceneView& View)
+{
+	if (View.bIsSceneCapture && !View.bIsPlanarReflection && !View.bIsReflectionCapture)
+	{
+		INC_DWORD_STAT(STAT_AsyncReprojectionSceneCaptureViews);
+	}
+}
+
+void FAsyncReprojectionViewScheduler::DiscoverCaptures_GameThread(const FAsyncReprojectionCVarState& CVarState, double NowSeconds)
+{
+	ReleasedCaptures.RemoveAllSwap([](const TWeakObjectPtr<USceneCaptureComponent>& Released)
+	{
+		return !Released.IsValid();
+	});
+
+	for (TObjectIterator<USceneCaptureComponent> It; It; ++It)
+	{
+		USceneCaptureComponent* Component = *It;
+
+		// Captures that do not capture every frame are already driven by game code; editor and preview worlds are left alone.
+		const UWorld* World = Component->GetWorld();
+		if (!Component->bCaptureEveryFrame
+			|| !Component->IsRegistered()
+			|| World == nullptr
+			|| !World->IsGameWorld()
+			|| !(Component->IsA<USceneCaptureComponent2D>() || Component->IsA<USceneCaptureComponentCube>()))
+		{
+			continue;
+		}
+
+		const bool bAlreadyScheduled = ScheduledCaptures.ContainsByPredicate([Component](const FScheduledCapture& Scheduled)
+		{
+			return Scheduled.Component.Get() == Component;
+		});
+		if (bAlreadyScheduled || ReleasedCaptures.Contains(Component))
+		{
+			continue;
+		}
+
+		FScheduledCapture& Scheduled = ScheduledCaptures.AddDefaulted_GetRef();
+		Scheduled.Component = Component;
+		Scheduled.bCaptureEveryFrame = Component->bCaptureEveryFrame;
+		Scheduled.bCaptureOnMovement = Component->bCaptureOnMovement;
+		// It captured every frame until now, so its cadence starts from this frame.
+		Scheduled.LastCaptureSeconds = NowSeconds;
+
+		Component->bCaptureEveryFrame = false;
+		Component->bCaptureOnMovement = false;
+
+		UE_LOG(LogAsyncReprojection, Log, TEXT("ViewScheduler adopted scene capture %s (TargetFPS=%.2f)."), *Component->GetPathName(), CVarState.SecondaryViewsTargetFPS);
+	}
+}
+
+bool FAsyncReprojectionViewScheduler::IsCaptureTicking(const USceneCaptureComponent& Component)
+{
+	return Component.IsActive() && Component.IsVisible() && Component.IsComponentTickEnabled();
+}
+
+void FAsyncReprojectionViewScheduler::RestoreCaptures_GameThread()
+{
+	if (ScheduledCaptures.Num() == 0)
+	{
+		return;
+	}
+
+	for (const FScheduledCapture& Scheduled : ScheduledCaptures)
+	{
+		if (USceneCaptureComponent* Component = Scheduled.Component.Get())
+		{
+			Component->bCaptureEveryFrame = Scheduled.bCaptureEveryFrame;
+			Component->bCaptureOnMovement = Scheduled.bCaptureOnMovement;
+		}
+	}
+
+	UE_LOG(LogAsyncReprojection, Log, TEXT("ViewScheduler released %d scene capture(s)."), ScheduledCaptures.Num());
+	ScheduledCaptures.Reset();
+	SET_DWORD_STAT(STAT_AsyncReprojectionSceneCapturesDecimated, 0);
+}
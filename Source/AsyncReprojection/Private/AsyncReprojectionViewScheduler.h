@@ -0,0 +1,71 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class FSceneView;
+class USceneCaptureComponent;
+
+struct FAsyncReprojectionCVarState;
+
+/**
+ * @class FAsyncReprojectionViewScheduler
+ *
+ * Decimates secondary view families (r.AsyncReprojection.SecondaryViews). AsyncPresent only switches off the game
+ * viewport's world render; scene captures that capture every frame keep rendering at full rate. While decimation is
+ * on, the scheduler takes over those captures and queues each one on its own cadence, so its render target holds the
+ * last capture in between. The capture flags it overrides are restored once decimation stops. Game code that turns
+ * bCaptureEveryFrame back on takes the capture back: the scheduler stops managing it and never adopts it again.
+ */
+class FAsyncReprojectionViewScheduler final
+{
+public:
+	static FAsyncReprojectionViewScheduler& Get();
+
+	void Shutdown();
+
+	/**
+	 * Queues the scene captures due this frame; called once per frame after AsyncPresent decided whether the world
+	 * renders.
+	 *
+	 * @param bWorldRendersThisFrame Whether the game viewport renders the world this frame.
+	 */
+	void Tick_GameThread(const FAsyncReprojectionCVarState& CVarState, bool bWorldRendersThisFrame);
+
+	/** Counts scene capture views about to render for `stat AsyncReprojection`; called from the view extension's SetupView. */
+	void NotifyView_GameThread(const FSceneView& View);
+
+private:
+	FAsyncReprojectionViewScheduler() = default;
+
+	/** Adopts game-world scene captures that capture every frame and are not scheduled yet. */
+	void DiscoverCaptures_GameThread(const FAsyncReprojectionCVarState& CVarState, double NowSeconds);
+
+	/** Hands every scheduled capture back with the flags it had when it was adopted. */
+	void RestoreCaptures_GameThread();
+
+	/** Whether the engine would tick, and so capture, the component if it still captured every frame. */
+	static bool IsCaptureTicking(const USceneCaptureComponent& Component);
+
+	/**
+	 * @struct FScheduledCapture
+	 *
+	 * A scene capture the scheduler drives, with the capture flags it overrides.
+	 */
+	struct FScheduledCapture
+	{
+		TWeakObjectPtr<USceneCaptureComponent> Component;
+		bool bCaptureEveryFrame = true;
+		bool bCaptureOnMovement = true;
+		double LastCaptureSeconds = 0.0;
+	};
+
+	TArray<FScheduledCapture> ScheduledCaptures;
+
+	/** Captures game code took back from the scheduler; discovery leaves them alone. */
+	TArray<TWeakObjectPtr<USceneCaptureComponent>> ReleasedCaptures;
+	double LastDiscoverySeconds = 0.0;
+	uint64 LastVerboseLogFrame = 0;
+};
@@ -0,0 +1,634 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#include "AsyncReprojectionWarpBenchmark.h"
+
+#include "Async/ParallelFor.h"
+#include "RHICommandList.h"
+#include "RenderTargetPool.h"
+
+namespace AsyncReprojectionWarpBenchmarkPrivate
+{
+	/** Near plane of the synthetic reversed-Z projection; device Z is NearPlaneCm / SceneDepth. */
+	static constexpr float NearPlaneCm = 10.0f;
+	static constexpr float HalfFOVDegrees = 45.0f;
+	static constexpr float SkyFraction = 0.25f;
+	static constexpr int32 CheckerSizePixels = 32;
+	/** Edge of the synthetic far-field map; the default of r.AsyncReprojection.FarField.Resolution. */
+	static constexpr int32 FarFieldSizePixels = 256;
+	/** World-space Z of the lowest direction the synthetic far field has seen; below it the map is uncovered. */
+	static constexpr float FarFieldMinDirectionZ = -0.1f;
+
+	/** Camera flick and strafe between the rendered and the latest pose. */
+	static const FRotator DeltaRotation(-0.75f, 1.5f, 0.0f);
+	static const FVector DeltaTranslationCm(2.0f, 4.0f, 0.5f);
+
+	/**
+	 * @struct FSyntheticObject
+	 *
+	 * Near box of the synthetic frame, in fractions of the extent; gives the depth-aware paths disocclusions to handle.
+	 */
+	struct FSyntheticObject
+	{
+		FVector2f Min;
+		FVector2f Max;
+		float DepthCm;
+		FLinearColor Color;
+		/** Object motion in fractions of the extent per second. */
+		FVector2f Motion;
+	};
+
+	static const FSyntheticObject SyntheticObjects[] =
+	{
+		{ FVector2f(0.08f, 0.40f), FVector2f(0.22f, 0.85f), 250.0f, FLinearColor(0.8f, 0.2f, 0.1f), FVector2f(0.20f, 0.00f) },
+		{ FVector2f(0.30f, 0.50f), FVector2f(0.42f, 0.70f), 600.0f, FLinearColor(0.1f, 0.6f, 0.2f), FVector2f(0.00f, 0.00f) },
+		{ FVector2f(0.55f, 0.35f), FVector2f(0.62f, 0.95f), 180.0f, FLinearColor(0.2f, 0.3f, 0.9f), FVector2f(-0.35f, 0.05f) },
+		{ FVector2f(0.70f, 0.55f), FVector2f(0.90f, 0.80f), 400.0f, FLinearColor(0.9f, 0.8f, 0.2f), FVector2f(0.10f, -0.10f) },
+	};
+
+	/** HUD boxes of the synthetic UI layer, in fractions of the extent. */
+	static const FBox2f HudBoxes[] =
+	{
+		FBox2f(FVector2f(0.03f, 0.90f), FVector2f(0.25f, 0.95f)),
+		FBox2f(FVector2f(0.495f, 0.48f), FVector2f(0.505f, 0.52f)),
+		FBox2f(FVector2f(0.80f, 0.04f), FVector2f(0.97f, 0.12f)),
+	};
+
+	static FVector4f Mul(const FVector4f& Row, const FMatrix44f& Matrix)
+	{
+		return Matrix.TransformFVector4(Row);
+	}
+
+	/** HLSL mul(float3x3 Matrix, Column). */
+	static FVector3f MulColumn(const FMatrix44f& Matrix, const FVector3f& Column)
+	{
+		return FVector3f(
+			Matrix.M[0][0] * Column.X + Matrix.M[0][1] * Column.Y + Matrix.M[0][2] * Column.Z,
+			Matrix.M[1][0] * Column.X + Matrix.M[1][1] * Column.Y + Matrix.M[1][2] * Column.Z,
+			Matrix.M[2][0] * Column.X + Matrix.M[2][1] * Column.Y + Matrix.M[2][2] * Column.Z);
+	}
+
+	static FVector3f ToVector3f(const FFloat16Color& Color)
+	{
+		return FVector3f(Color.R.GetFloat(), Color.G.GetFloat(), Color.B.GetFloat());
+	}
+
+	static FVector4f ToVector4f(const FColor& Color)
+	{
+		const FLinearColor Linear = Color.ReinterpretAsLinear();
+		return FVector4f(Linear.R, Linear.G, Linear.B, Linear.A);
+	}
+
+	static FVector4f ToVector4f(const FFloat16Color& Color)
+	{
+		return FVector4f(Color.R.GetFloat(), Color.G.GetFloat(), Color.B.GetFloat(), Color.A.GetFloat());
+	}
+
+	/** Ports of AsyncReprojectionFarFieldCommon.ush. */
+	static FVector2f FarFieldSignNotZero(const FVector2f& Value)
+	{
+		return FVector2f(Value.X >= 0.0f ? 1.0f : -1.0f, Value.Y >= 0.0f ? 1.0f : -1.0f);
+	}
+
+	static FVector2f FarFieldDirectionToOctahedron(FVector3f Direction)
+	{
+		Direction /= FMath::Abs(Direction.X) + FMath::Abs(Direction.Y) + FMath::Abs(Direction.Z);
+		if (Direction.Z < 0.0f)
+		{
+			return (FVector2f(1.0f, 1.0f) - FVector2f(FMath::Abs(Direction.Y), FMath::Abs(Direction.X))) * FarFieldSignNotZero(FVector2f(Direction.X, Direction.Y));
+		}
+		return FVector2f(Direction.X, Direction.Y);
+	}
+
+	static FVector3f FarFieldOctahedronToDirection(const FVector2f& Octahedron)
+	{
+		FVector3f Direction(Octahedron.X, Octahedron.Y, 1.0f - FMath::Abs(Octahedron.X) - FMath::Abs(Octahedron.Y));
+		if (Direction.Z < 0.0f)
+		{
+			const FVector2f Folded = (FVector2f(1.0f, 1.0f) - FVector2f(FMath::Abs(Direction.Y), FMath::Abs(Direction.X))) * FarFieldSignNotZero(FVector2f(Direction.X, Direction.Y));
+			Direction.X = Folded.X;
+			Direction.Y = Folded.Y;
+		}
+		return Direction.GetSafeNormal();
+	}
+
+	/**
+	 * @class FReferenceSampler
+	 *
+	 * Clamp-addressed texture reads over the synthetic scene with the sampler filters the shaders bind.
+	 */
+	class FReferenceSampler
+	{
+	public:
+		explicit FReferenceSampler(const FAsyncReprojectionBenchmarkScene& InScene)
+			: Scene(InScene)
+			, MaxPixel(InScene.Extent.X - 1, InScene.Extent.Y - 1)
+		{
+		}
+
+		FVector3f SampleColorBilinear(const FVector2f& UV) const
+		{
+			return SampleBilinear(UV, Scene.Extent, [this](int32 Index) { return ToVector3f(Scene.Color[Index]); });
+		}
+
+		FVector4f SampleUiBilinear(const FVector2f& UV) const
+		{
+			return SampleBilinear(UV, Scene.Extent, [this](int32 Index) { return ToVector4f(Scene.Ui[Index]); });
+		}
+
+		FVector4f SampleFarFieldBilinear(const FVector2f& UV) const
+		{
+			const FIntPoint FarFieldExtent(Scene.FarFieldSize, Scene.FarFieldSize);
+			return SampleBilinear(UV, FarFieldExtent, [this](int32 Index) { return ToVector4f(Scene.FarField[Index]); });
+		}
+
+		float SampleDeviceZPoint(const FVector2f& UV) const
+		{
+			return Scene.DeviceZ[PointIndex(UV)];
+		}
+
+		FVector2f SampleObjectMotionPoint(const FVector2f& UV) const
+		{
+			const FVector2DHalf& Motion = Scene.ObjectMotion[PointIndex(UV)];
+			return FVector2f(Motion.X.GetFloat(), Motion.Y.GetFloat());
+		}
+
+	private:
+		int32 PointIndex(const FVector2f& UV) const
+		{
+			const int32 X = FMath::Clamp(FMath::FloorToInt32(UV.X * float(Scene.Extent.X)), 0, MaxPixel.X);
+			const int32 Y = FMath::Clamp(FMath::FloorToInt32(UV.Y * float(Scene.Extent.Y)), 0, MaxPixel.Y);
+			return Y * Scene.Extent.X + X;
+		}
+
+		template<typename TFetch>
+		static auto SampleBilinear(const FVector2f& UV, const FIntPoint& Extent, TFetch&& Fetch)
+		{
+			const float X = UV.X * float(Extent.X) - 0.5f;
+			const float Y = UV.Y * float(Extent.Y) - 0.5f;
+			const float FloorX = FMath::FloorToFloat(X);
+			const float FloorY = FMath::FloorToFloat(Y);
+			const float FracX = X - FloorX;
+			const float FracY = Y - FloorY;
+
+			const int32 X0 = FMath::Clamp(int32(FloorX), 0, Extent.X - 1);
+			const int32 X1 = FMath::Clamp(int32(FloorX) + 1, 0, Extent.X - 1);
+			const int32 Y0 = FMath::Clamp(int32(FloorY), 0, Extent.Y - 1);
+			const int32 Y1 = FMath::Clamp(int32(FloorY) + 1, 0, Extent.Y - 1);
+
+			const int32 Width = Extent.X;
+			const auto Top = FMath::Lerp(Fetch(Y0 * Width + X0), Fetch(Y0 * Width + X1), FracX);
+			const auto Bottom = FMath::Lerp(Fetch(Y1 * Width + X0), Fetch(Y1 * Width + X1), FracX);
+			return FMath::Lerp(Top, Bottom, FracY);
+		}
+
+		const FAsyncReprojectionBenchmarkScene& Scene;
+		FIntPoint MaxPixel;
+	};
+
+	/**
+	 * @class FReferenceWarp
+	 *
+	 * Per-pixel port of AsyncReprojectionPresentWarp.usf and AsyncReprojectionCachedWarpCommon.ush for a full-frame
+	 * view, so the cached-rect mapping reduces to the identity.
+	 */
+	class FReferenceWarp
+	{
+	public:
+		FReferenceWarp(const FAsyncReprojectionBenchmarkPermutation& InPermutation, const FAsyncReprojectionBenchmarkView& InView, const FAsyncReprojectionBenchmarkScene& Scene)
+			: Permutation(InPermutation)
+			, View(InView)
+			, Sampler(Scene)
+			, Size(float(InView.Extent.X), float(InView.Extent.Y))
+			, InvSize(1.0f / float(InView.Extent.X), 1.0f / float(InView.Extent.Y))
+		{
+		}
+
+		FVector3f PresentWarp(const FVector2f& OutPixelCenter) const
+		{
+			const FVector3f UnwarpedColor = Sampler.SampleColorBilinear(OutPixelCenter * InvSize);
+			const FVector3f WarpedColor = Sampler.SampleColorBilinear(ComputeRotationOnlySourcePixel(OutPixelCenter) * InvSize);
+			return FMath::Lerp(UnwarpedColor, WarpedColor, FMath::Clamp(View.WarpWeight, 0.0f, 1.0f));
+		}
+
+		FVector3f CachedWarp(const FVector2f& OutPixelCenter) const
+		{
+			const FVector3f UnwarpedColor = Sampler.SampleColorBilinear(OutPixelCenter * InvSize);
+
+			FVector3f WarpedColor;
+			if (!WarpCachedWorld(OutPixelCenter, WarpedColor))
+			{
+				return FVector3f::ZeroVector;
+			}
+
+			return FMath::Lerp(UnwarpedColor, WarpedColor, FMath::Clamp(View.WarpWeight, 0.0f, 1.0f));
+		}
+
+		FVector3f CachedWarpComposite(const FVector2f& OutPixelCenter) const
+		{
+			const FVector4f UiColor = Sampler.SampleUiBilinear(OutPixelCenter * InvSize);
+			const FVector3f UnwarpedWorldColor = Sampler.SampleColorBilinear(OutPixelCenter * InvSize);
+
+			FVector3f WarpedWorldColor;
+			if (!WarpCachedWorld(OutPixelCenter, WarpedWorldColor))
+			{
+				return FVector3f::ZeroVector;
+			}
+
+			const FVector3f WorldColor = FMath::Lerp(UnwarpedWorldColor, WarpedWorldColor, FMath::Clamp(View.WarpWeight, 0.0f, 1.0f));
+
+			const FVector3f UiDelta = (FVector3f(UiColor) - WarpedWorldColor).GetAbs();
+			const float AlphaAssist = (UiColor.W < 0.999f) ? UiColor.W : 0.0f;
+			const float UiSignal = FMath::Max(UiDelta.GetMax(), AlphaAssist);
+			const float UiMask = UiSignal >= View.UiMaskThreshold ? 1.0f : 0.0f;
+			return FMath::Lerp(WorldColor, FVector3f(UiColor), UiMask);
+		}
+
+	private:
+		FVector2f PixelToNDC(const FVector2f& PixelCenter) const
+		{
+			return (PixelCenter / Size) * 2.0f - FVector2f(1.0f, 1.0f);
+		}
+
+		FVector2f NDCToPixel(const FVector2f& NDC) const
+		{
+			return (NDC * 0.5f + FVector2f(0.5f, 0.5f)) * Size;
+		}
+
+		FVector2f ClampToRectUV(const FVector2f& UV) const
+		{
+			return FVector2f(
+				FMath::Clamp(UV.X, 0.5f * InvSize.X, (Size.X - 0.5f) * InvSize.X),
+				FMath::Clamp(UV.Y, 0.5f * InvSize.Y, (Size.Y - 0.5f) * InvSize.Y));
+		}
+
+		bool IsInBoundsUV(const FVector2f& UV) const
+		{
+			const FVector2f Pixel = UV * Size;
+			return Pixel.X >= 0.0f && Pixel.Y >= 0.0f && Pixel.X <= Size.X && Pixel.Y <= Size.Y;
+		}
+
+		FVector2f ComputeRotationOnlySourcePixel(const FVector2f& OutPixelCenter) const
+		{
+			const FVector2f OutNDC = PixelToNDC(OutPixelCenter);
+			FVector4f LatestViewPos = Mul(FVector4f(OutNDC.X, OutNDC.Y, 1.0f, 1.0f), View.ClipToView);
+			const FVector3f LatestView = FVector3f(LatestViewPos) / FMath::Max(LatestViewPos.W, 1e-6f);
+
+			const FVector3f RenderedViewPos = MulColumn(View.DeltaRotationInv4x4, LatestView);
+			const FVector4f RenderedClip = Mul(FVector4f(RenderedViewPos, 1.0f), View.ViewToClip);
+			const float InvW = 1.0f / FMath::Max(RenderedClip.W, 1e-6f);
+			return NDCToPixel(FVector2f(RenderedClip.X * InvW, RenderedClip.Y * InvW));
+		}
+
+		FVector2f ExtrapolateObjectMotion(const FVector2f& SourcePixelCoord) const
+		{
+			const float Seconds = View.ObjectMotionSeconds;
+			const FVector2f Half(0.5f, 0.5f);
+
+			const FVector2f FirstDisplacement = Sampler.SampleObjectMotionPoint(ClampToRectUV((SourcePixelCoord + Half) * InvSize)) * Seconds;
+			const FVector2f SecondDisplacement = Sampler.SampleObjectMotionPoint(ClampToRectUV((SourcePixelCoord - FirstDisplacement + Half) * InvSize)) * Seconds;
+
+			const float Disagreement = (SecondDisplacement - FirstDisplacement).Size() / FMath::Max(FirstDisplacement.Size(), 1.0f);
+			const float Confidence = FMath::Clamp(1.0f - Disagreement, 0.0f, 1.0f);
+			return SourcePixelCoord - SecondDisplacement * Confidence;
+		}
+
+		bool SampleFarFieldAtCachedPixel(const FVector2f& SourcePixelCenter, FVector3f& OutColor) const
+		{
+			const FVector4f NearPoint = Mul(FVector4f(SourcePixelCenter.X, SourcePixelCenter.Y, 1.0f, 1.0f), View.SVPositionToTranslatedWorld);
+			const FVector4f MidPoint = Mul(FVector4f(SourcePixelCenter.X, SourcePixelCenter.Y, 0.5f, 1.0f), View.SVPositionToTranslatedWorld);
+			const FVector3f Direction = (FVector3f(MidPoint) / MidPoint.W - FVector3f(NearPoint) / NearPoint.W).GetSafeNormal();
+
+			const FVector4f FarField = Sampler.SampleFarFieldBilinear(FarFieldDirectionToOctahedron(Direction) * 0.5f + FVector2f(0.5f, 0.5f));
+			if (FarField.W < 0.5f)
+			{
+				return false;
+			}
+
+			OutColor = FVector3f(FarField) / FarField.W;
+			return true;
+		}
+
+		bool WarpCachedWorld(const FVector2f& OutPixelCenter, FVector3f& OutWarpedColor) const
+		{
+			const FVector2f Half(0.5f, 0.5f);
+			FVector2f SourcePixelCoord = OutPixelCenter - Half;
+			bool bUseRotationOnly = !Permutation.bTranslation;
+
+			for (int32 Iter = 0; Iter < 2 && !bUseRotationOnly; Iter++)
+			{
+				const FVector2f SourcePixelCenter = SourcePixelCoord + Half;
+				const float DeviceZ = Sampler.SampleDeviceZPoint(ClampToRectUV(SourcePixelCenter * InvSize));
+				if (DeviceZ <= 0.0f)
+				{
+					bUseRotationOnly = true;
+					break;
+				}
+
+				const FVector4f TranslatedWorldPos = Mul(FVector4f(SourcePixelCenter.X, SourcePixelCenter.Y, DeviceZ, 1.0f), View.SVPositionToTranslatedWorld);
+				const FVector3f TranslatedWorld = FVector3f(TranslatedWorldPos) / FMath::Max(TranslatedWorldPos.W, 1e-6f);
+
+				const FVector4f LatestClip = Mul(FVector4f(TranslatedWorld, 1.0f), View.TranslatedWorldToLatestClip);
+				if (LatestClip.W <= 1e-6f)
+				{
+					bUseRotationOnly = true;
+					break;
+				}
+
+				const FVector2f LatestPixelCenter = NDCToPixel(FVector2f(LatestClip.X / LatestClip.W, LatestClip.Y / LatestClip.W));
+				SourcePixelCoord -= LatestPixelCenter - OutPixelCenter;
+				SourcePixelCoord = FVector2f(
+					FMath::Clamp(SourcePixelCoord.X, 0.0f, Size.X - 1.0f),
+					FMath::Clamp(SourcePixelCoord.Y, 0.0f, Size.Y - 1.0f));
+			}
+
+			if (bUseRotationOnly)
+			{
+				SourcePixelCoord = ComputeRotationOnlySourcePixel(OutPixelCenter) - Half;
+			}
+
+			if (Permutation.bObjectMotion)
+			{
+				SourcePixelCoord = ExtrapolateObjectMotion(SourcePixelCoord);
+			}
+
+			const FVector2f SourceUV = (SourcePixelCoord + Half) * InvSize;
+			const bool bOutOfBounds = !IsInBoundsUV(SourceUV);
+			if (Permutation.bFarField && bOutOfBounds && SampleFarFieldAtCachedPixel(SourcePixelCoord + Half, OutWarpedColor))
+			{
+				return true;
+			}
+			if (!Permutation.bStretchBorders && bOutOfBounds)
+			{
+				return false;
+			}
+
+			const FVector2f CenterUV = ClampToRectUV(SourceUV);
+			FVector2f BestUV = CenterUV;
+			if (Permutation.bOcclusionFallback)
+			{
+				const FVector2f NeighbourUVs[] =
+				{
+					ClampToRectUV(SourceUV + FVector2f(-InvSize.X, 0.0f)),
+					ClampToRectUV(SourceUV + FVector2f(InvSize.X, 0.0f)),
+					ClampToRectUV(SourceUV + FVector2f(0.0f, -InvSize.Y)),
+					ClampToRectUV(SourceUV + FVector2f(0.0f, InvSize.Y)),
+				};
+
+				float BestDepth = Sampler.SampleDeviceZPoint(CenterUV);
+				for (const FVector2f& NeighbourUV : NeighbourUVs)
+				{
+					const float NeighbourDepth = Sampler.SampleDeviceZPoint(NeighbourUV);
+					if (NeighbourDepth > BestDepth)
+					{
+						BestDepth = NeighbourDepth;
+						BestUV = NeighbourUV;
+					}
+				}
+			}
+
+			OutWarpedColor = Sampler.SampleColorBilinear(BestUV);
+			return true;
+		}
+
+		const FAsyncReprojectionBenchmarkPermutation& Permutation;
+		const FAsyncReprojectionBenchmarkView& View;
+		FReferenceSampler Sampler;
+		FVector2f Size;
+		FVector2f InvSize;
+	};
+
+	static void UploadTarget(
+		FRHICommandListImmediate& RHICmdList,
+		const FIntPoint& Extent,
+		EPixelFormat Format,
+		const void* Data,
+		uint32 BytesPerPixel,
+		TRefCountPtr<IPooledRenderTarget>& Target,
+		const TCHAR* DebugName)
+	{
+		const FPooledRenderTargetDesc Desc = FPooledRenderTargetDesc::Create2DDesc(
+			Extent,
+			Format,
+			FClearValueBinding::None,
+			TexCreate_None,
+			TexCreate_ShaderResource,
+			false);
+		GRenderTargetPool.FindFreeElement(RHICmdList, Desc, Target, DebugName);
+
+		const FUpdateTextureRegion2D Region(0, 0, 0, 0, uint32(Extent.X), uint32(Extent.Y));
+		RHICmdList.UpdateTexture2D(Target->GetRHI(), 0, Region, uint32(Extent.X) * BytesPerPixel, static_cast<const uint8*>(Data));
+	}
+}
+
+const TCHAR* LexToString(EAsyncReprojectionBenchmarkKernel Kernel)
+{
+	switch (Kernel)
+	{
+	case EAsyncReprojectionBenchmarkKernel::PresentWarp: return TEXT("PresentWarp");
+	case EAsyncReprojectionBenchmarkKernel::CachedWarp: return TEXT("CachedWarp");
+	case EAsyncReprojectionBenchmarkKernel::CachedWarpComposite: return TEXT("CachedWarpComposite");
+	default: return TEXT("Unknown");
+	}
+}
+
+FString FAsyncReprojectionBenchmarkPermutation::ToString() const
+{
+	TArray<FString> Names;
+	if (bTranslation)
+	{
+		Names.Add(TEXT("Translation"));
+	}
+	if (bStretchBorders)
+	{
+		Names.Add(TEXT("StretchBorders"));
+	}
+	if (bOcclusionFallback)
+	{
+		Names.Add(TEXT("OcclusionFallback"));
+	}
+	if (bObjectMotion)
+	{
+		Names.Add(TEXT("ObjectMotion"));
+	}
+	if (bFarField)
+	{
+		Names.Add(TEXT("FarField"));
+	}
+	return Names.IsEmpty() ? FString(TEXT("RotationOnly")) : FString::Join(Names, TEXT("+"));
+}
+
+FAsyncReprojectionBenchmarkView FAsyncReprojectionBenchmarkView::Make(const FIntPoint& Extent)
+{
+	using namespace AsyncReprojectionWarpBenchmarkPrivate;
+
+	// UE view space looks down +Z with +X right and +Y up; world space looks down +X.
+	const FMatrix ViewAxes(
+		FPlane(0, 0, 1, 0),
+		FPlane(1, 0, 0, 0),
+		FPlane(0, 1, 0, 0),
+		FPlane(0, 0, 0, 1));
+
+	const FMatrix Projection = FReversedZPerspectiveMatrix(FMath::DegreesToRadians(HalfFOVDegrees), float(Extent.X), float(Extent.Y), NearPlaneCm);
+	const FMatrix RenderedTranslatedWorldToView = ViewAxes;
+	const FMatrix LatestTranslatedWorldToView = FTranslationMatrix(-DeltaTranslationCm) * FInverseRotationMatrix(DeltaRotation) * ViewAxes;
+
+	const FMatrix SVPositionToClip(
+		FPlane(2.0 / double(Extent.X), 0, 0, 0),
+		FPlane(0, -2.0 / double(Extent.Y), 0, 0),
+		FPlane(0, 0, 1, 0),
+		FPlane(-1, 1, 0, 1));
+
+	FAsyncReprojectionBenchmarkView View;
+	View.Extent = Extent;
+	View.ViewToClip = FMatrix44f(Projection);
+	View.ClipToView = FMatrix44f(Projection.Inverse());
+	View.SVPositionToTranslatedWorld = FMatrix44f(SVPositionToClip * (RenderedTranslatedWorldToView * Projection).Inverse());
+	View.TranslatedWorldToLatestClip = FMatrix44f(LatestTranslatedWorldToView * Projection);
+	View.DeltaRotationInv4x4 = FMatrix44f(FQuatRotationMatrix(DeltaRotation.Quaternion().Inverse()));
+	View.WarpWeight = 1.0f;
+	View.ObjectMotionSeconds = 1.0f / 60.0f;
+	return View;
+}
+
+FAsyncReprojectionBenchmarkScene FAsyncReprojectionBenchmarkScene::Make(const FIntPoint& Extent)
+{
+	using namespace AsyncReprojectionWarpBenchmarkPrivate;
+
+	FAsyncReprojectionBenchmarkScene Scene;
+	Scene.Extent = Extent;
+
+	const int32 NumPixels = Extent.X * Extent.Y;
+	Scene.Color.SetNumUninitialized(NumPixels);
+	Scene.DeviceZ.SetNumUninitialized(NumPixels);
+	Scene.ObjectMotion.SetNumUninitialized(NumPixels);
+	Scene.Ui.SetNumUninitialized(NumPixels);
+
+	const FVector2f Size(float(Extent.X), float(Extent.Y));
+	ParallelFor(Extent.Y, [&Scene, &Extent, &Size](int32 Y)
+	{
+		for (int32 X = 0; X < Extent.X; X++)
+		{
+			const int32 Index = Y * Extent.X + X;
+			const FVector2f UV((float(X) + 0.5f) / Size.X, (float(Y) + 0.5f) / Size.Y);
+
+			FLinearColor Color;
+			float DepthCm = 0.0f;
+			FVector2f Motion = FVector2f::ZeroVector;
+			if (UV.Y < SkyFraction)
+			{
+				Color = FLinearColor::LerpUsingHSV(FLinearColor(0.2f, 0.4f, 0.9f), FLinearColor(0.7f, 0.8f, 1.0f), UV.Y / SkyFraction);
+			}
+			else
+			{
+				const float GroundT = (UV.Y - SkyFraction) / (1.0f - SkyFraction);
+				DepthCm = FMath::Lerp(5000.0f, 200.0f, GroundT);
+
+				const bool bChecker = ((X / CheckerSizePixels) + (Y / CheckerSizePixels)) % 2 == 0;
+				Color = (bChecker ? FLinearColor(0.45f, 0.45f, 0.4f) : FLinearColor(0.25f, 0.3f, 0.25f)) * (0.5f + 0.5f * GroundT);
+
+				for (const FSyntheticObject& Object : SyntheticObjects)
+				{
+					if (UV.X >= Object.Min.X && UV.X <= Object.Max.X && UV.Y >= Object.Min.Y && UV.Y <= Object.Max.Y && Object.DepthCm < DepthCm)
+					{
+						DepthCm = Object.DepthCm;
+						Color = Object.Color * (bChecker ? 1.0f : 0.8f);
+						Motion = Object.Motion * Size;
+					}
+				}
+			}
+
+			Scene.Color[Index] = FFloat16Color(Color);
+			Scene.DeviceZ[Index] = DepthCm > 0.0f ? NearPlaneCm / DepthCm : 0.0f;
+			Scene.ObjectMotion[Index] = FVector2DHalf(Motion.X, Motion.Y);
+
+			Scene.Ui[Index] = FColor(0, 0, 0, 0);
+			for (const FBox2f& HudBox : HudBoxes)
+			{
+				if (HudBox.IsInside(UV))
+				{
+					Scene.Ui[Index] = FColor(230, 230, 230, 255);
+				}
+			}
+		}
+	});
+
+	// World space is Z up; the map fades from a haze at the horizon to the zenith and is uncovered below the horizon.
+	Scene.FarFieldSize = FarFieldSizePixels;
+	Scene.FarField.SetNumUninitialized(FarFieldSizePixels * FarFieldSizePixels);
+	ParallelFor(FarFieldSizePixels, [&Scene](int32 Y)
+	{
+		for (int32 X = 0; X < FarFieldSizePixels; X++)
+		{
+			const FVector2f Octahedron = FVector2f((float(X) + 0.5f) / float(FarFieldSizePixels), (float(Y) + 0.5f) / float(FarFieldSizePixels)) * 2.0f - FVector2f(1.0f, 1.0f);
+			const FVector3f Direction = FarFieldOctahedronToDirection(Octahedron);
+
+			FLinearColor Color = FLinearColor::Transparent;
+			if (Direction.Z >= FarFieldMinDirectionZ)
+			{
+				Color = FLinearColor::LerpUsingHSV(FLinearColor(0.7f, 0.8f, 1.0f), FLinearColor(0.2f, 0.4f, 0.9f), FMath::Clamp(Direction.Z, 0.0f, 1.0f));
+				Color.A = 1.0f;
+			}
+			Scene.FarField[Y * FarFieldSizePixels + X] = FFloat16Color(Color);
+		}
+	});
+
+	return Scene;
+}
+
+void FAsyncReprojectionBenchmarkTargets::Upload_RenderThread(FRHICommandListImmediate& RHICmdList, const FAsyncReprojectionBenchmarkScene& Scene)
+{
+	using namespace AsyncReprojectionWarpBenchmarkPrivate;
+
+	UploadTarget(RHICmdList, Scene.Extent, PF_FloatRGBA, Scene.Color.GetData(), sizeof(FFloat16Color), Color, TEXT("AsyncReprojection.BenchmarkColor"));
+	UploadTarget(RHICmdList, Scene.Extent, PF_R32_FLOAT, Scene.DeviceZ.GetData(), sizeof(float), DeviceZ, TEXT("AsyncReprojection.BenchmarkDeviceZ"));
+	UploadTarget(RHICmdList, Scene.Extent, PF_G16R16F, Scene.ObjectMotion.GetData(), sizeof(FVector2DHalf), ObjectMotion, TEXT("AsyncReprojection.BenchmarkObjectMotion"));
+	UploadTarget(RHICmdList, Scene.Extent, PF_B8G8R8A8, Scene.Ui.GetData(), sizeof(FColor), Ui, TEXT("AsyncReprojection.BenchmarkUi"));
+	UploadTarget(RHICmdList, FIntPoint(Scene.FarFieldSize, Scene.FarFieldSize), PF_FloatRGBA, Scene.FarField.GetData(), sizeof(FFloat16Color), FarField, TEXT("AsyncReprojection.BenchmarkFarField"));
+
+	const FPooledRenderTargetDesc OutputDesc = FPooledRenderTargetDesc::Create2DDesc(
+		Scene.Extent,
+		PF_B8G8R8A8,
+		FClearValueBinding::Black,
+		TexCreate_None,
+		TexCreate_ShaderResource | TexCreate_RenderTargetable,
+		false);
+	GRenderTargetPool.FindFreeElement(RHICmdList, OutputDesc, Output, TEXT("AsyncReprojection.BenchmarkOutput"));
+}
+
+void AsyncReprojectionWarpBenchmark::RunReferenceKernel(
+	EAsyncReprojectionBenchmarkKernel Kernel,
+	const FAsyncReprojectionBenchmarkPermutation& Permutation,
+	const FAsyncReprojectionBenchmarkView& View,
+	const FAsyncReprojectionBenchmarkScene& Scene,
+	TArray<FLinearColor>& OutColor)
+{
+	using namespace AsyncReprojectionWarpBenchmarkPrivate;
+	check(View.Extent == Scene.Extent);
+
+	OutColor.SetNumUninitialized(Scene.Extent.X * Scene.Extent.Y);
+
+	const FReferenceWarp Warp(Permutation, View, Scene);
+	ParallelFor(Scene.Extent.Y, [&Warp, &OutColor, Kernel, Width = Scene.Extent.X](int32 Y)
+	{
+		for (int32 X = 0; X < Width; X++)
+		{
+			const FVector2f OutPixelCenter(float(X) + 0.5f, float(Y) + 0.5f);
+
+			FVector3f Color;
+			switch (Kernel)
+			{
+			case EAsyncReprojectionBenchmarkKernel::PresentWarp:
+				Color = Warp.PresentWarp(OutPixelCenter);
+				break;
+			case EAsyncReprojectionBenchmarkKernel::CachedWarpComposite:
+				Color = Warp.CachedWarpComposite(OutPixelCenter);
+				break;
+			default:
+				Color = Warp.CachedWarp(OutPixelCenter);
+				break;
+			}
+
+			OutColor[Y * Width + X] = FLinearColor(Color.X, Color.Y, Color.Z, 1.0f);
+		}
+	});
+}
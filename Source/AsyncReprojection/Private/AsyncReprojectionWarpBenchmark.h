@@ -0,0 +1,111 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RendererInterface.h"
+
+/** Warp kernels measured by UAsyncReprojectionBenchmarkCommandlet. */
+enum class EAsyncReprojectionBenchmarkKernel : uint8
+{
+	/** Rotation-only back-buffer warp (WarpAfterUI); same reprojection as the scene Warp without depth. */
+	PresentWarp,
+	/** Cached-frame warp of the PreSlate present path. */
+	CachedWarp,
+	/** Cached-frame warp with the HUD composite of the back-buffer present path. */
+	CachedWarpComposite
+};
+
+const TCHAR* LexToString(EAsyncReprojectionBenchmarkKernel Kernel);
+
+/**
+ * @struct FAsyncReprojectionBenchmarkPermutation
+ *
+ * Present-time toggles of one benchmark case; the cached kernels compile each combination as its own permutation.
+ */
+struct FAsyncReprojectionBenchmarkPermutation
+{
+	bool bTranslation = false;
+	bool bStretchBorders = false;
+	bool bOcclusionFallback = false;
+	bool bObjectMotion = false;
+	bool bFarField = false;
+
+	FString ToString() const;
+};
+
+/**
+ * @struct FAsyncReprojectionBenchmarkView
+ *
+ * Rendered view and pose delta of the synthetic frame, shared by the GPU passes and the CPU reference so both warp the
+ * same pixels. The translated world is centered on the rendered camera.
+ */
+struct FAsyncReprojectionBenchmarkView
+{
+	FIntPoint Extent = FIntPoint::ZeroValue;
+
+	FMatrix44f ViewToClip = FMatrix44f::Identity;
+	FMatrix44f ClipToView = FMatrix44f::Identity;
+	FMatrix44f SVPositionToTranslatedWorld = FMatrix44f::Identity;
+	FMatrix44f TranslatedWorldToLatestClip = FMatrix44f::Identity;
+	FMatrix44f DeltaRotationInv4x4 = FMatrix44f::Identity;
+
+	float WarpWeight = 1.0f;
+	float ObjectMotionSeconds = 0.0f;
+	float UiMaskThreshold = 0.08f;
+
+	/** A short camera flick and strafe at a 90 degree field of view. */
+	static FAsyncReprojectionBenchmarkView Make(const FIntPoint& Extent);
+};
+
+/**
+ * @struct FAsyncReprojectionBenchmarkScene
+ *
+ * Synthetic frame in the formats the frame cache captures: half-float color, reversed device Z with a sky band of
+ * zero depth, G16R16F object motion in pixels per second and an 8-bit UI layer with a few opaque HUD boxes. The
+ * octahedral far-field map has seen the sky and the horizon but not the ground below it, so border pixels exercise
+ * both the far-field fill and the border policy.
+ */
+struct FAsyncReprojectionBenchmarkScene
+{
+	FIntPoint Extent = FIntPoint::ZeroValue;
+	TArray<FFloat16Color> Color;
+	TArray<float> DeviceZ;
+	TArray<FVector2DHalf> ObjectMotion;
+	TArray<FColor> Ui;
+	int32 FarFieldSize = 0;
+	TArray<FFloat16Color> FarField;
+
+	static FAsyncReprojectionBenchmarkScene Make(const FIntPoint& Extent);
+};
+
+/**
+ * @struct FAsyncReprojectionBenchmarkTargets
+ *
+ * GPU copies of a FAsyncReprojectionBenchmarkScene; ObjectMotion and FarField are only bound when a case needs them.
+ */
+struct FAsyncReprojectionBenchmarkTargets
+{
+	TRefCountPtr<IPooledRenderTarget> Color;
+	TRefCountPtr<IPooledRenderTarget> DeviceZ;
+	TRefCountPtr<IPooledRenderTarget> ObjectMotion;
+	TRefCountPtr<IPooledRenderTarget> Ui;
+	TRefCountPtr<IPooledRenderTarget> FarField;
+	TRefCountPtr<IPooledRenderTarget> Output;
+
+	void Upload_RenderThread(FRHICommandListImmediate& RHICmdList, const FAsyncReprojectionBenchmarkScene& Scene);
+};
+
+namespace AsyncReprojectionWarpBenchmark
+{
+	/**
+	 * Software implementation of a warp kernel, mirroring the shader math pixel for pixel; used to time the kernels on
+	 * machines without a GPU. Rows are spread over the task graph like the GPU spreads them over waves.
+	 */
+	void RunReferenceKernel(
+		EAsyncReprojectionBenchmarkKernel Kernel,
+		const FAsyncReprojectionBenchmarkPermutation& Permutation,
+		const FAsyncReprojectionBenchmarkView& View,
+		const FAsyncReprojectionBenchmarkScene& Scene,
+		TArray<FLinearColor>& OutColor);
+}
@@ -0,0 +1,132 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#include "AsyncReprojectionWarpMetrics.h"
+
+#include "AsyncReprojectionCVars.h"
+#include "AsyncReprojectionStats.h"
+
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "RHIGPUReadback.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+
+DEFINE_STAT(STAT_AsyncReprojectionWarpRotationOnlyFallback);
+DEFINE_STAT(STAT_AsyncReprojectionWarpOutOfBounds);
+DEFINE_STAT(STAT_AsyncReprojectionWarpOcclusionFallback);
+
+CSV_DEFINE_CATEGORY(AsyncReprojection, true);
+
+namespace AsyncReprojectionWarpMetricsPrivate
+{
+	static constexpr double MaxAutoMetricsAgeSeconds = 1.0;
+}
+
+FAsyncReprojectionWarpMetrics& FAsyncReprojectionWarpMetrics::Get()
+{
+	static FAsyncReprojectionWarpMetrics Instance;
+	return Instance;
+}
+
+FAsyncReprojectionWarpMetrics::FAsyncReprojectionWarpMetrics() = default;
+FAsyncReprojectionWarpMetrics::~FAsyncReprojectionWarpMetrics() = default;
+
+FRDGBufferRef FAsyncReprojectionWarpMetrics::BeginPresent_RenderThread(FRDGBuilder& GraphBuilder, const FAsyncReprojectionCVarState& CVarState)
+{
+	PollReadbacks_RenderThread();
+
+	if (!CVarState.bWarpMetrics || NumPending >= NumReadbacks)
+	{
+		return nullptr;
+	}
+
+	FRDGBufferRef MetricsBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), NumMetrics),
+		TEXT("AsyncReprojection.WarpMetrics"));
+	AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(MetricsBuffer, PF_R32_UINT), 0u);
+	return MetricsBuffer;
+}
+
+void FAsyncReprojectionWarpMetrics::EndPresent_RenderThread(FRDGBuilder& GraphBuilder, FRDGBufferRef MetricsBuffer)
+{
+	if (MetricsBuffer == nullptr || NumPending >= NumReadbacks)
+	{
+		return;
+	}
+
+	const int32 WriteIndex = (ReadIndex + NumPending) % NumReadbacks;
+	if (!Readbacks[WriteIndex].IsValid())
+	{
+		Readbacks[WriteIndex] = MakeUnique<FRHIGPUBufferReadback>(TEXT("AsyncReprojection.WarpMetricsReadback"));
+	}
+
+	AddEnqueueCopyPass(GraphBuilder, Readbacks[WriteIndex].Get(), MetricsBuffer, sizeof(uint32) * NumMetrics);
+	NumPending++;
+}
+
+void FAsyncReprojectionWarpMetrics::PollReadbacks_RenderThread()
+{
+	while (NumPending > 0 && Readbacks[ReadIndex]->IsReady())
+	{
+		uint32 Counters[NumMetrics] = {};
+		if (const uint32* Data = static_cast<const uint32*>(Readbacks[ReadIndex]->Lock(sizeof(Counters))))
+		{
+			FMemory::Memcpy(Counters, Data, sizeof(Counters));
+			Readbacks[ReadIndex]->Unlock();
+			Publish_RenderThread(Counters);
+		}
+
+		ReadIndex = (ReadIndex + 1) % NumReadbacks;
+		NumPending--;
+	}
+}
+
+void FAsyncReprojectionWarpMetrics::Publish_RenderThread(const uint32 (&Counters)[NumMetrics])
+{
+	const uint32 NumPixels = Counters[Pixels];
+	if (NumPixels == 0)
+	{
+		return;
+	}
+
+	const float InvPixels = 1.0f / float(NumPixels);
+
+	FAsyncReprojectionWarpMetricsSnapshot Snapshot;
+	Snapshot.bIsValid = true;
+	Snapshot.NumPixels = NumPixels;
+	Snapshot.RotationOnlyFallbackRatio = float(Counters[RotationOnlyFallback]) * InvPixels;
+	Snapshot.OutOfBoundsRatio = float(Counters[OutOfBounds]) * InvPixels;
+	Snapshot.OcclusionFallbackRatio = float(Counters[OcclusionFallback]) * InvPixels;
+	Snapshot.ReadbackTimeSeconds = FPlatformTime::Seconds();
+
+	Latest.Publish(Snapshot, GFrameCounterRenderThread, Snapshot.ReadbackTimeSeconds);
+
+	SET_FLOAT_STAT(STAT_AsyncReprojectionWarpRotationOnlyFallback, Snapshot.RotationOnlyFallbackRatio * 100.0f);
+	SET_FLOAT_STAT(STAT_AsyncReprojectionWarpOutOfBounds, Snapshot.OutOfBoundsRatio * 100.0f);
+	SET_FLOAT_STAT(STAT_AsyncReprojectionWarpOcclusionFallback, Snapshot.OcclusionFallbackRatio * 100.0f);
+
+	CSV_CUSTOM_STAT(AsyncReprojection, WarpRotationOnlyFallbackPct, Snapshot.RotationOnlyFallbackRatio * 100.0f, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(AsyncReprojection, WarpOutOfBoundsPct, Snapshot.OutOfBoundsRatio * 100.0f, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(AsyncReprojection, WarpOcclusionFallbackPct, Snapshot.OcclusionFallbackRatio * 100.0f, ECsvCustomStatOp::Set);
+}
+
+FAsyncReprojectionWarpMetricsSnapshot FAsyncReprojectionWarpMetrics::GetLatest_AnyThread() const
+{
+	return Latest.Read();
+}
+
+bool FAsyncReprojectionWarpMetrics::IsWithinAutoLimits_AnyThread(const FAsyncReprojectionCVarState& CVarState) const
+{
+	if (!CVarState.bWarpMetrics || CVarState.AutoMaxWarpFallbackRatio <= 0.0f)
+	{
+		return true;
+	}
+
+	const FAsyncReprojectionWarpMetricsSnapshot Snapshot = GetLatest_AnyThread();
+	if (!Snapshot.bIsValid || (FPlatformTime::Seconds() - Snapshot.ReadbackTimeSeconds) > AsyncReprojectionWarpMetricsPrivate::MaxAutoMetricsAgeSeconds)
+	{
+		return true;
+	}
+
+	const float FallbackRatio = FMath::Max(Snapshot.RotationOnlyFallbackRatio, Snapshot.OutOfBoundsRatio);
+	return FallbackRatio <= CVarState.AutoMaxWarpFallbackRatio;
+}
@@ -0,0 +1,90 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AsyncReprojectionSnapshotChannel.h"
+#include "RenderGraphDefinitions.h"
+
+class FRDGBuilder;
+class FRHIGPUBufferReadback;
+
+struct FAsyncReprojectionCVarState;
+
+/**
+ * @struct FAsyncReprojectionWarpMetricsSnapshot
+ *
+ * Fractions of the cached-warp pixels of the most recent present whose counters have been read back.
+ */
+struct FAsyncReprojectionWarpMetricsSnapshot
+{
+	bool bIsValid = false;
+	uint32 NumPixels = 0;
+	float RotationOnlyFallbackRatio = 0.0f;
+	float OutOfBoundsRatio = 0.0f;
+	float OcclusionFallbackRatio = 0.0f;
+	double ReadbackTimeSeconds = 0.0;
+};
+
+/**
+ * @class FAsyncReprojectionWarpMetrics
+ *
+ * GPU warp-quality counters of the cached present warp (r.AsyncReprojection.WarpMetrics). The warp shaders count
+ * rotation-only fallbacks, out-of-bounds samples and occlusion-fallback hits into a small buffer per present. The
+ * buffers go through a ring of readbacks that is only polled, never waited on, so results trail the present by a few
+ * frames and a present is left unmeasured when every readback is still in flight.
+ */
+class FAsyncReprojectionWarpMetrics final
+{
+public:
+	/** Counter slots; must match WARP_METRIC_* in AsyncReprojectionCachedWarpCommon.ush. */
+	enum EMetric : uint32
+	{
+		Pixels = 0,
+		RotationOnlyFallback = 1,
+		OutOfBounds = 2,
+		OcclusionFallback = 3,
+		NumMetrics = 4
+	};
+
+	static FAsyncReprojectionWarpMetrics& Get();
+
+	/**
+	 * Publishes completed readbacks, then creates and clears this present's counters.
+	 *
+	 * @return Counter buffer for the warp passes, or nullptr when metrics are disabled or no readback is free.
+	 */
+	FRDGBufferRef BeginPresent_RenderThread(FRDGBuilder& GraphBuilder, const FAsyncReprojectionCVarState& CVarState);
+
+	/** Queues the present's counters for readback. */
+	void EndPresent_RenderThread(FRDGBuilder& GraphBuilder, FRDGBufferRef MetricsBuffer);
+
+	FAsyncReprojectionWarpMetricsSnapshot GetLatest_AnyThread() const;
+
+	/**
+	 * Whether Auto mode may keep warping given the latest metrics and r.AsyncReprojection.AutoMaxWarpFallbackRatio.
+	 * Metrics older than a second are ignored so a warp that Auto mode stopped is measured again.
+	 */
+	bool IsWithinAutoLimits_AnyThread(const FAsyncReprojectionCVarState& CVarState) const;
+
+private:
+	FAsyncReprojectionWarpMetrics();
+	~FAsyncReprojectionWarpMetrics();
+
+	void PollReadbacks_RenderThread();
+	void Publish_RenderThread(const uint32 (&Counters)[NumMetrics]);
+
+private:
+	static constexpr int32 NumReadbacks = 4;
+
+	/**
+	 * Owned by the rendering thread; pending readbacks are ReadIndex .. ReadIndex + NumPending - 1 (mod NumReadbacks).
+	 * The readbacks are a few bytes each and live as long as the module, so an in-flight copy never outlives its target.
+	 */
+	TUniquePtr<FRHIGPUBufferReadback> Readbacks[NumReadbacks];
+	int32 ReadIndex = 0;
+	int32 NumPending = 0;
+
+	/** Published by the rendering thread, polled by Auto mode and the debug overlay. */
+	TAsyncReprojectionSnapshotChannel<FAsyncReprojectionWarpMetricsSnapshot> Latest;
+};
@@ -7,14 +7,23 @@
 #include "AsyncReprojectionCameraTracker.h"
 #include "AsyncReprojectionCVars.h"
 #include "AsyncReprojectionFrameCache.h"
+#include "AsyncReprojectionStereo.h"
+#include "AsyncReprojectionWarpBenchmark.h"
+#include "AsyncReprojectionWarpMetrics.h"
 
+#include "CommonRenderResources.h"
 #include "DynamicRHI.h"
 #include "HAL/IConsoleManager.h"
+#include "PipelineStateCache.h"
 #include "RHICommandList.h"
+#include "RHIStaticStates.h"
 #include "RenderGraphUtils.h"
 #include "ScreenPass.h"
 #include "SceneRenderTargetParameters.h"
 #include "ShaderParameterStruct.h"
+#include "ShaderPlatformCachedIniValue.h"
+
+DECLARE_GPU_STAT_NAMED(AsyncReprojectionCachedPresent, TEXT("AsyncReprojection CachedPresent"));
 
 namespace AsyncReprojectionWarpPrivate
 {
@@ -23,6 +32,16 @@ namespace AsyncReprojectionWarpPrivate
 	static uint64 LastCachedPreSlateWarnFrame = 0;
 	static uint64 LastCachedBackBufferWarnFrame = 0;
 
+	/**
+	 * Registers a viewport back buffer outside Slate's graph. Slate and the engine present transition the back buffer
+	 * through registrations of their own, so each graph wraps it anew: RDG then starts from an unknown access state and
+	 * always emits the transition into the first pass instead of trusting a state left by an earlier graph.
+	 */
+	static FRDGTextureRef RegisterPreSlateBackBuffer(FRDGBuilder& GraphBuilder, FRHITexture* BackBufferTexture)
+	{
+		return GraphBuilder.RegisterExternalTexture(CreateRenderTarget(BackBufferTexture, TEXT("AsyncReprojection.PreSlateBackBuffer")));
+	}
+
 	static FMatrix ToFMatrix(const FMatrix44f& In)
 	{
 		FMatrix Out(EForceInit::ForceInitToZero);
@@ -94,41 +113,256 @@ namespace AsyncReprojectionWarpPrivate
 
 	IMPLEMENT_GLOBAL_SHADER(FAsyncReprojectionPresentWarpPS, "/Plugin/AsyncReprojection/Private/AsyncReprojectionPresentWarp.usf", "MainPS", SF_Pixel);
 
+	/**
+	 * Permutation dimensions shared by the cached-frame warp shaders.
+	 * Present-time toggles are compiled in so the hot present pass runs branch-free.
+	 */
+	class FCachedWarpUseTranslation : SHADER_PERMUTATION_BOOL("USE_TRANSLATION");
+	class FCachedWarpStretchBorders : SHADER_PERMUTATION_BOOL("STRETCH_BORDERS");
+	class FCachedWarpOcclusionFallback : SHADER_PERMUTATION_BOOL("OCCLUSION_FALLBACK");
+	class FCachedWarpDebugOverlay : SHADER_PERMUTATION_BOOL("DEBUG_OVERLAY");
+	class FCachedWarpObjectMotion : SHADER_PERMUTATION_BOOL("OBJECT_MOTION");
+	class FCachedWarpMetrics : SHADER_PERMUTATION_BOOL("WARP_METRICS");
+	class FCachedWarpFarField : SHADER_PERMUTATION_BOOL("FAR_FIELD");
+
+	/**
+	 * Compiled per shader and platform, out of 128 vectors: DEBUG_OVERLAY and WARP_METRICS are never combined, and
+	 * OCCLUSION_FALLBACK needs USE_TRANSLATION or OBJECT_MOTION, which leaves 84 with every dimension compiled. Cooking
+	 * without the debug permutations leaves 28. CompileObjectMotionPermutations=0 cuts these to 36 and 12,
+	 * CompileFarFieldPermutations=0 to 42 and 14, and both together to 18 and 6.
+	 */
+	using FCachedWarpPermutationDomain = TShaderPermutationDomain<
+		FCachedWarpUseTranslation,
+		FCachedWarpStretchBorders,
+		FCachedWarpOcclusionFallback,
+		FCachedWarpDebugOverlay,
+		FCachedWarpObjectMotion,
+		FCachedWarpMetrics,
+		FCachedWarpFarField>;
+
+	/**
+	 * The foreground warp is camera-only: it never extrapolates object motion or samples the far field. The same rules
+	 * leave 18 of its 32 vectors, or 6 without the debug permutations.
+	 */
+	using FCachedWarpForegroundPermutationDomain = TShaderPermutationDomain<
+		FCachedWarpUseTranslation,
+		FCachedWarpStretchBorders,
+		FCachedWarpOcclusionFallback,
+		FCachedWarpDebugOverlay,
+		FCachedWarpMetrics>;
+
+	/**
+	 * Whether the target being compiled for gets debug-only permutations: the debug overlay and warp metrics. Decided from the target, not from the binary
+	 * doing the compiling: editor targets always do, cooked targets follow r.AsyncReprojection.CompileDebugPermutations
+	 * in the config of their shader platform.
+	 */
+	static bool ShouldCompileDebugPermutations(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		if (EnumHasAnyFlags(Parameters.Flags, EShaderPermutationFlags::HasEditorOnlyData))
+		{
+			return true;
+		}
+
+		static FShaderPlatformCachedIniValue<bool> CompileDebugPermutations(TEXT("r.AsyncReprojection.CompileDebugPermutations"));
+		return CompileDebugPermutations.Get(Parameters.Platform);
+	}
+
+	/**
+	 * Whether the target gets the object motion and far-field permutations. Unlike the debug permutations, these follow
+	 * the config of the shader platform on editor targets too, so a project that never uses a feature skips it everywhere.
+	 */
+	static bool ShouldCompileObjectMotionPermutations(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		static FShaderPlatformCachedIniValue<bool> CompileObjectMotionPermutations(TEXT("r.AsyncReprojection.CompileObjectMotionPermutations"));
+		return CompileObjectMotionPermutations.Get(Parameters.Platform);
+	}
+
+	static bool ShouldCompileFarFieldPermutations(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		static FShaderPlatformCachedIniValue<bool> CompileFarFieldPermutations(TEXT("r.AsyncReprojection.CompileFarFieldPermutations"));
+		return CompileFarFieldPermutations.Get(Parameters.Platform);
+	}
+
+	static bool ShouldCompileCachedWarpPermutation(const FGlobalShaderPermutationParameters& Parameters, const FCachedWarpPermutationDomain& PermutationVector)
+	{
+		if (!IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5))
+		{
+			return false;
+		}
+
+		if ((PermutationVector.Get<FCachedWarpDebugOverlay>() || PermutationVector.Get<FCachedWarpMetrics>()) && !ShouldCompileDebugPermutations(Parameters))
+		{
+			return false;
+		}
+
+		// MakeCachedWarpPermutation drops the debug markers while the metrics are counted.
+		if (PermutationVector.Get<FCachedWarpDebugOverlay>() && PermutationVector.Get<FCachedWarpMetrics>())
+		{
+			return false;
+		}
+
+		if ((PermutationVector.Get<FCachedWarpObjectMotion>() && !ShouldCompileObjectMotionPermutations(Parameters))
+			|| (PermutationVector.Get<FCachedWarpFarField>() && !ShouldCompileFarFieldPermutations(Parameters)))
+		{
+			return false;
+		}
+
+		// Without camera translation or object motion nothing is disoccluded, so MakeCachedWarpPermutation never asks for
+		// the occlusion fallback.
+		if (PermutationVector.Get<FCachedWarpOcclusionFallback>()
+			&& !PermutationVector.Get<FCachedWarpUseTranslation>()
+			&& !PermutationVector.Get<FCachedWarpObjectMotion>())
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	static FCachedWarpPermutationDomain MakeCachedWarpPermutation(const FAsyncReprojectionCVarState& CVarState, bool bDoTranslation, bool bObjectMotion, bool bMetrics, bool bFarField)
+	{
+		FCachedWarpPermutationDomain PermutationVector;
+		PermutationVector.Set<FCachedWarpUseTranslation>(bDoTranslation);
+		PermutationVector.Set<FCachedWarpStretchBorders>(CVarState.bAsyncPresentStretchBorders);
+		PermutationVector.Set<FCachedWarpOcclusionFallback>(CVarState.bAsyncPresentOcclusionFallback && (bDoTranslation || bObjectMotion));
+		PermutationVector.Set<FCachedWarpDebugOverlay>(CVarState.bDebugOverlay && FAsyncReprojectionCVars::CanUseDebugPermutations() && !bMetrics);
+		PermutationVector.Set<FCachedWarpObjectMotion>(bObjectMotion);
+		PermutationVector.Set<FCachedWarpMetrics>(bMetrics);
+		PermutationVector.Set<FCachedWarpFarField>(bFarField);
+		return PermutationVector;
+	}
+
+	static FCachedWarpPermutationDomain ToCachedWarpPermutation(const FCachedWarpForegroundPermutationDomain& ForegroundVector)
+	{
+		FCachedWarpPermutationDomain PermutationVector;
+		PermutationVector.Set<FCachedWarpUseTranslation>(ForegroundVector.Get<FCachedWarpUseTranslation>());
+		PermutationVector.Set<FCachedWarpStretchBorders>(ForegroundVector.Get<FCachedWarpStretchBorders>());
+		PermutationVector.Set<FCachedWarpOcclusionFallback>(ForegroundVector.Get<FCachedWarpOcclusionFallback>());
+		PermutationVector.Set<FCachedWarpDebugOverlay>(ForegroundVector.Get<FCachedWarpDebugOverlay>());
+		PermutationVector.Set<FCachedWarpMetrics>(ForegroundVector.Get<FCachedWarpMetrics>());
+		return PermutationVector;
+	}
+
+	static FCachedWarpForegroundPermutationDomain ToForegroundPermutation(const FCachedWarpPermutationDomain& PermutationVector)
+	{
+		check(!PermutationVector.Get<FCachedWarpObjectMotion>() && !PermutationVector.Get<FCachedWarpFarField>());
+
+		FCachedWarpForegroundPermutationDomain ForegroundVector;
+		ForegroundVector.Set<FCachedWarpUseTranslation>(PermutationVector.Get<FCachedWarpUseTranslation>());
+		ForegroundVector.Set<FCachedWarpStretchBorders>(PermutationVector.Get<FCachedWarpStretchBorders>());
+		ForegroundVector.Set<FCachedWarpOcclusionFallback>(PermutationVector.Get<FCachedWarpOcclusionFallback>());
+		ForegroundVector.Set<FCachedWarpDebugOverlay>(PermutationVector.Get<FCachedWarpDebugOverlay>());
+		ForegroundVector.Set<FCachedWarpMetrics>(PermutationVector.Get<FCachedWarpMetrics>());
+		return ForegroundVector;
+	}
+
+	/** Players warped by one batched draw; bounded by the texture slots declared in AsyncReprojectionCachedWarpCommon.ush. */
+	static constexpr int32 MaxPlayersPerCachedWarpBatch = 4;
+
+	/** Per-player warp constants; layout must match FCachedWarpPlayerConstants in AsyncReprojectionCachedWarpCommon.ush. */
+	struct FCachedWarpPlayerConstants
+	{
+		FMatrix44f RenderedSVPositionToTranslatedWorld;
+		FMatrix44f TranslatedWorldToLatestClip;
+		FMatrix44f DeltaRotationInv4x4;
+		FMatrix44f ViewToClip;
+		FMatrix44f ClipToView;
+		FVector4f ViewRectMinAndSize;
+		FVector4f BufferSizeAndInvSize;
+		FVector4f OutputRectMinAndSize;
+		float WarpWeight;
+		float ObjectMotionSeconds;
+		float OverscanScale;
+		float FarFieldEnabled;
+	};
+
+	static_assert(sizeof(FCachedWarpPlayerConstants) % 16 == 0, "FCachedWarpPlayerConstants must stay 16-byte aligned for the structured buffer.");
+
+	/** Pose input flags; must match CACHED_WARP_POSE_FLAG_* in AsyncReprojectionCachedWarpParams.usf. */
+	static constexpr uint32 CachedWarpPoseFlagRotation = 1u << 0;
+	static constexpr uint32 CachedWarpPoseFlagTranslation = 1u << 1;
+	static constexpr uint32 CachedWarpPoseFlagAutoWarpLimit = 1u << 2;
+
+	/**
+	 * Raw per-player poses for r.AsyncReprojection.AsyncPresent.GPUWarpParams; layout must match FCachedWarpPoseInputs in
+	 * AsyncReprojectionCachedWarpParams.usf. Locations are relative to the rendered camera so they stay float-precise.
+	 */
+	struct FCachedWarpPoseInputs
+	{
+		FVector4f RenderedRotation;
+		FVector4f LatestRotation;
+		FVector4f RenderedTranslatedOrigin;
+		FVector4f LatestLocationOffset;
+		FVector4f InputTurnDegrees;
+		FVector4f MaxDeltaPerFrame;
+		FVector4f AutoMaxWarp;
+		float BaseWeight = 0.0f;
+		float ObjectMotionSeconds = 0.0f;
+		uint32 Flags = 0;
+		uint32 Padding = 0;
+	};
+
+	static_assert(sizeof(FCachedWarpPoseInputs) % 16 == 0, "FCachedWarpPoseInputs must stay 16-byte aligned for the structured buffer.");
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FCachedWarpSourceParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FCachedWarpPlayerConstants>, PlayerConstants)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedColorTexture0)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedColorTexture1)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedColorTexture2)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedColorTexture3)
+		SHADER_PARAMETER_SAMPLER(SamplerState, CachedColorSampler)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedDepthDeviceZTexture0)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedDepthDeviceZTexture1)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedDepthDeviceZTexture2)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedDepthDeviceZTexture3)
+		SHADER_PARAMETER_SAMPLER(SamplerState, CachedDepthSampler)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedObjectMotionTexture0)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedObjectMotionTexture1)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedObjectMotionTexture2)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedObjectMotionTexture3)
+		SHADER_PARAMETER_SAMPLER(SamplerState, CachedObjectMotionSampler)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, FarFieldTexture0)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, FarFieldTexture1)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, FarFieldTexture2)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, FarFieldTexture3)
+		SHADER_PARAMETER_SAMPLER(SamplerState, FarFieldSampler)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, RWWarpMetrics)
+	END_SHADER_PARAMETER_STRUCT()
+
+	class FAsyncReprojectionCachedWarpVS : public FGlobalShader
+	{
+	public:
+		DECLARE_GLOBAL_SHADER(FAsyncReprojectionCachedWarpVS);
+		SHADER_USE_PARAMETER_STRUCT(FAsyncReprojectionCachedWarpVS, FGlobalShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FCachedWarpPlayerConstants>, PlayerConstants)
+			SHADER_PARAMETER(FVector4f, OutputSizeAndInvSize)
+		END_SHADER_PARAMETER_STRUCT()
+
+		static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+		{
+			return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+		}
+	};
+
+	IMPLEMENT_GLOBAL_SHADER(FAsyncReprojectionCachedWarpVS, "/Plugin/AsyncReprojection/Private/AsyncReprojectionCachedWarp.usf", "MainVS", SF_Vertex);
+
 	class FAsyncReprojectionCachedWarpPS : public FGlobalShader
 	{
 	public:
 		DECLARE_GLOBAL_SHADER(FAsyncReprojectionCachedWarpPS);
 		SHADER_USE_PARAMETER_STRUCT(FAsyncReprojectionCachedWarpPS, FGlobalShader);
 
-		class FUseTranslation : SHADER_PERMUTATION_BOOL("USE_TRANSLATION");
-		using FPermutationDomain = TShaderPermutationDomain<FUseTranslation>;
+		using FPermutationDomain = FCachedWarpPermutationDomain;
 
 		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
-			SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedColorTexture)
-			SHADER_PARAMETER_SAMPLER(SamplerState, CachedColorSampler)
-			SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedDepthDeviceZTexture)
-			SHADER_PARAMETER_SAMPLER(SamplerState, CachedDepthSampler)
-
-			SHADER_PARAMETER(FMatrix44f, RenderedSVPositionToTranslatedWorld)
-			SHADER_PARAMETER(FMatrix44f, TranslatedWorldToLatestClip)
-			SHADER_PARAMETER(FMatrix44f, DeltaRotationInv4x4)
-			SHADER_PARAMETER(FMatrix44f, ViewToClip)
-			SHADER_PARAMETER(FMatrix44f, ClipToView)
-
-				SHADER_PARAMETER(FVector4f, ViewRectMinAndSize)
-				SHADER_PARAMETER(FVector4f, BufferSizeAndInvSize)
-				SHADER_PARAMETER(float, WarpWeight)
-				SHADER_PARAMETER(FVector2f, CachedInvSize)
-				SHADER_PARAMETER(uint32, StretchBorders)
-				SHADER_PARAMETER(uint32, OcclusionFallback)
-				SHADER_PARAMETER(uint32, DebugOverlay)
-
-				RENDER_TARGET_BINDING_SLOTS()
-			END_SHADER_PARAMETER_STRUCT()
+			SHADER_PARAMETER_STRUCT_INCLUDE(FCachedWarpSourceParameters, Source)
+		END_SHADER_PARAMETER_STRUCT()
 
 		static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 		{
-			return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+			return ShouldCompileCachedWarpPermutation(Parameters, FPermutationDomain(Parameters.PermutationId));
 		}
 	};
 
@@ -140,35 +374,63 @@ namespace AsyncReprojectionWarpPrivate
 		DECLARE_GLOBAL_SHADER(FAsyncReprojectionCachedWarpCompositePS);
 		SHADER_USE_PARAMETER_STRUCT(FAsyncReprojectionCachedWarpCompositePS, FGlobalShader);
 
-		class FUseTranslation : SHADER_PERMUTATION_BOOL("USE_TRANSLATION");
-		using FPermutationDomain = TShaderPermutationDomain<FUseTranslation>;
+		using FPermutationDomain = FCachedWarpPermutationDomain;
 
 		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
-			SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedColorTexture)
-			SHADER_PARAMETER_SAMPLER(SamplerState, CachedColorSampler)
-			SHADER_PARAMETER_RDG_TEXTURE(Texture2D, CachedDepthDeviceZTexture)
-			SHADER_PARAMETER_SAMPLER(SamplerState, CachedDepthSampler)
+			SHADER_PARAMETER_STRUCT_INCLUDE(FCachedWarpSourceParameters, Source)
 
 			SHADER_PARAMETER_RDG_TEXTURE(Texture2D, UiTexture)
 			SHADER_PARAMETER_SAMPLER(SamplerState, UiSampler)
-
-			SHADER_PARAMETER(FMatrix44f, RenderedSVPositionToTranslatedWorld)
-			SHADER_PARAMETER(FMatrix44f, TranslatedWorldToLatestClip)
-			SHADER_PARAMETER(FMatrix44f, DeltaRotationInv4x4)
-			SHADER_PARAMETER(FMatrix44f, ViewToClip)
-			SHADER_PARAMETER(FMatrix44f, ClipToView)
-
-			SHADER_PARAMETER(FVector4f, ViewRectMinAndSize)
-			SHADER_PARAMETER(FVector4f, BufferSizeAndInvSize)
-			SHADER_PARAMETER(float, WarpWeight)
-			SHADER_PARAMETER(FVector2f, CachedInvSize)
 			SHADER_PARAMETER(FVector2f, UiInvSize)
 			SHADER_PARAMETER(float, UiMaskThreshold)
-			SHADER_PARAMETER(uint32, StretchBorders)
-			SHADER_PARAMETER(uint32, OcclusionFallback)
-			SHADER_PARAMETER(uint32, DebugOverlay)
+		END_SHADER_PARAMETER_STRUCT()
 
-			RENDER_TARGET_BINDING_SLOTS()
+		static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+		{
+			return ShouldCompileCachedWarpPermutation(Parameters, FPermutationDomain(Parameters.PermutationId));
+		}
+	};
+
+	IMPLEMENT_GLOBAL_SHADER(FAsyncReprojectionCachedWarpCompositePS, "/Plugin/AsyncReprojection/Private/AsyncReprojectionCachedWarpComposite.usf", "MainPS", SF_Pixel);
+
+	/** Draws the warp under the foreground layer, which covers the pixels it left scene depth on. */
+	class FAsyncReprojectionCachedWarpForegroundPS : public FGlobalShader
+	{
+	public:
+		DECLARE_GLOBAL_SHADER(FAsyncReprojectionCachedWarpForegroundPS);
+		SHADER_USE_PARAMETER_STRUCT(FAsyncReprojectionCachedWarpForegroundPS, FGlobalShader);
+
+		using FPermutationDomain = FCachedWarpForegroundPermutationDomain;
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_STRUCT_INCLUDE(FCachedWarpSourceParameters, Source)
+
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D, ForegroundTexture)
+			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, ForegroundDepthTexture)
+			SHADER_PARAMETER_SAMPLER(SamplerState, ForegroundDepthSampler)
+			SHADER_PARAMETER(FVector2f, ForegroundDepthInvSize)
+			SHADER_PARAMETER_ARRAY(FVector4f, ForegroundDepthRectMinAndSize, [MaxPlayersPerCachedWarpBatch])
+		END_SHADER_PARAMETER_STRUCT()
+
+		static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+		{
+			return ShouldCompileCachedWarpPermutation(Parameters, ToCachedWarpPermutation(FPermutationDomain(Parameters.PermutationId)));
+		}
+	};
+
+	IMPLEMENT_GLOBAL_SHADER(FAsyncReprojectionCachedWarpForegroundPS, "/Plugin/AsyncReprojection/Private/AsyncReprojectionCachedWarpForeground.usf", "MainPS", SF_Pixel);
+
+	/** Derives the clamped delta matrices and warp weight of a batch from its raw poses (GPUWarpParams). */
+	class FAsyncReprojectionCachedWarpParamsCS : public FGlobalShader
+	{
+	public:
+		DECLARE_GLOBAL_SHADER(FAsyncReprojectionCachedWarpParamsCS);
+		SHADER_USE_PARAMETER_STRUCT(FAsyncReprojectionCachedWarpParamsCS, FGlobalShader);
+
+		BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+			SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FCachedWarpPoseInputs>, PoseInputs)
+			SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<FCachedWarpPlayerConstants>, RWPlayerConstants)
+			SHADER_PARAMETER(uint32, NumPlayers)
 		END_SHADER_PARAMETER_STRUCT()
 
 		static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -177,7 +439,79 @@ namespace AsyncReprojectionWarpPrivate
 		}
 	};
 
-	IMPLEMENT_GLOBAL_SHADER(FAsyncReprojectionCachedWarpCompositePS, "/Plugin/AsyncReprojection/Private/AsyncReprojectionCachedWarpComposite.usf", "MainPS", SF_Pixel);
+	IMPLEMENT_GLOBAL_SHADER(FAsyncReprojectionCachedWarpParamsCS, "/Plugin/AsyncReprojection/Private/AsyncReprojectionCachedWarpParams.usf", "MainCS", SF_Compute);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FCachedWarpBatchPassParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FAsyncReprojectionCachedWarpVS::FParameters, VS)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FAsyncReprojectionCachedWarpPS::FParameters, PS)
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FCachedWarpCompositeBatchPassParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FAsyncReprojectionCachedWarpVS::FParameters, VS)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FAsyncReprojectionCachedWarpCompositePS::FParameters, PS)
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FCachedWarpForegroundBatchPassParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FAsyncReprojectionCachedWarpVS::FParameters, VS)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FAsyncReprojectionCachedWarpForegroundPS::FParameters, PS)
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+
+	/**
+	 * @struct FCachedWarpPoseLatch
+	 *
+	 * One player's GPUWarpParams pose inputs. The latest camera and input totals are latched again when the graph uploads
+	 * the pose buffer; stereo eyes keep the head pose queried at gather time.
+	 */
+	struct FCachedWarpPoseLatch
+	{
+		int32 PlayerIndex = INDEX_NONE;
+		bool bLatchLatestCamera = false;
+		bool bInputDriven = false;
+		FVector RenderedLocation = FVector::ZeroVector;
+		FAsyncReprojectionInputTotals RenderedInputTotals;
+		FVector2f InputDegreesPerPixel = FVector2f::ZeroVector;
+		FCachedWarpPoseInputs PoseInputs;
+	};
+
+	using FCachedWarpPoseLatchArray = TArray<FCachedWarpPoseLatch, TInlineAllocator<MaxPlayersPerCachedWarpBatch>>;
+
+	/**
+	 * @struct FCachedWarpPlayerSource
+	 *
+	 * One local player's cached frame and the warp constants derived for this present.
+	 */
+	struct FCachedWarpPlayerSource
+	{
+		int32 PlayerIndex = INDEX_NONE;
+		TRefCountPtr<IPooledRenderTarget> CachedColor;
+		TRefCountPtr<IPooledRenderTarget> CachedDepthDeviceZ;
+		/** Only set when object motion extrapolation is enabled and the capture recorded it. */
+		TRefCountPtr<IPooledRenderTarget> CachedObjectMotion;
+		/** Only set when r.AsyncReprojection.FarField is enabled and the player's far-field map holds captures. */
+		TRefCountPtr<IPooledRenderTarget> CachedFarField;
+		FAsyncReprojectionCachedFrameConstants CachedConstants;
+		/** With GPUWarpParams only the pose-independent fields are filled; the rest come from PoseLatch on the GPU. */
+		FCachedWarpPlayerConstants WarpConstants;
+		FCachedWarpPoseLatch PoseLatch;
+	};
+
+	using FCachedWarpPlayerSourceArray = TArray<FCachedWarpPlayerSource, TInlineAllocator<MaxPlayersPerCachedWarpBatch>>;
+
+	/**
+	 * @struct FCachedWarpForegroundLayer
+	 *
+	 * Foreground layer the Foreground present path draws the warp under: a copy of the view family output and the
+	 * scene depth it was rendered with, whose view rect per view slot is listed in DepthRectByViewSlot.
+	 */
+	struct FCachedWarpForegroundLayer
+	{
+		FRDGTextureRef Color = nullptr;
+		FRDGTextureRef SceneDepth = nullptr;
+		const TMap<int32, FIntRect>* DepthRectByViewSlot = nullptr;
+	};
 
 	static bool IsWarpAfterUIEnabled()
 	{
@@ -276,7 +610,7 @@ void FAsyncReprojectionBackBufferWarp::AddPassIfEnabled(FRDGBuilder& GraphBuilde
 		return;
 	}
 
-	const FAsyncReprojectionCameraSnapshot LatestCamera = FAsyncReprojectionCameraTracker::Get().GetLatestCamera(0);
+	const FAsyncReprojectionCameraSnapshot LatestCamera = FAsyncReprojectionCameraTracker::Get().GetLatestCamera_RenderThread(0, CVarState);
 	if (!LatestCamera.bIsValid)
 	{
 		return;
@@ -375,26 +709,22 @@ void FAsyncReprojectionBackBufferWarp::AddPassIfEnabled(FRDGBuilder& GraphBuilde
 		EScreenPassDrawFlags::None);
 }
 
-static FQuat ComputeInputDrivenDeltaQuat_RenderThread(const FAsyncReprojectionCVarState& CVarState, const FAsyncReprojectionRenderedViewSnapshot& RenderedViewSnapshot, const FQuat& RenderedRotation)
+static FQuat ComputeInputDrivenDeltaQuat_RenderThread(const FAsyncReprojectionCVarState& CVarState, int32 PlayerIndex, const FAsyncReprojectionRenderedViewSnapshot& RenderedViewSnapshot, const FQuat& RenderedRotation)
 {
 	if (!CVarState.bInputDrivenPose || !RenderedViewSnapshot.bIsValid)
 	{
 		return FQuat::Identity;
 	}
 
-	const float YawScale = CVarState.InputYawDegreesPerPixel;
-	const float PitchScale = CVarState.InputPitchDegreesPerPixel;
-	if (YawScale == 0.0f && PitchScale == 0.0f)
+	const FVector2f TurnDegrees = FAsyncReprojectionCameraTracker::Get().GetInputTotals_AnyThread(PlayerIndex).GetTurnDegreesSince(
+		RenderedViewSnapshot.InputTotals, CVarState.InputYawDegreesPerPixel, CVarState.InputPitchDegreesPerPixel);
+	if (TurnDegrees.IsNearlyZero())
 	{
 		return FQuat::Identity;
 	}
 
-	const FVector2f CurrentTotals = FAsyncReprojectionCameraTracker::Get().GetMouseTotals_RenderThread(0);
-	const float DeltaX = CurrentTotals.X - RenderedViewSnapshot.InputMouseXTotal;
-	const float DeltaY = CurrentTotals.Y - RenderedViewSnapshot.InputMouseYTotal;
-
-	const float YawDeg = DeltaX * YawScale;
-	const float PitchDeg = (-DeltaY) * PitchScale;
+	const float YawDeg = TurnDegrees.X;
+	const float PitchDeg = TurnDegrees.Y;
 
 	const FQuat YawQuat(FVector::UpVector, FMath::DegreesToRadians(YawDeg));
 	const FVector PitchAxis = RenderedRotation.RotateVector(FVector::RightVector);
@@ -444,92 +774,219 @@ static bool TryRestorePresentFallback(FRDGBuilder& GraphBuilder, FRDGTexture* Ba
 	return true;
 }
 
-void FAsyncReprojectionCachedPresentWarp::AddPreSlatePassIfEnabled(FRHICommandListImmediate& RHICmdList, FRHIViewport* ViewportRHI)
+enum class ECachedWarpPresentPath : uint8
+{
+	PreSlate,
+	Composite,
+	/** Drawn under the view family's foreground layer (r.AsyncReprojection.Foreground). */
+	Foreground
+};
+
+static const TCHAR* LexCachedWarpPresentPath(ECachedWarpPresentPath PresentPath)
 {
-	if (ViewportRHI == nullptr)
+	switch (PresentPath)
 	{
-		return;
+	case ECachedWarpPresentPath::PreSlate: return TEXT("PreSlate");
+	case ECachedWarpPresentPath::Foreground: return TEXT("Foreground");
+	default: return TEXT("BackBuffer");
 	}
+}
 
-	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
-	const bool bAsyncPipelineEnabled = CVarState.bAsyncPresent || CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
-	if (!bAsyncPipelineEnabled || !CVarState.bAsyncPresentAllowHUDStable)
+/**
+ * @struct FCachedWarpGate
+ *
+ * The part of a player's warp decision that does not depend on its poses.
+ */
+struct FCachedWarpGate
+{
+	/** Mode is On, or Auto with a stable frame rate sufficiently below the refresh rate. */
+	bool bModeActive = false;
+	/** Auto mode additionally disables the warp when the pose delta exceeds its limits. */
+	bool bAutoWarpLimit = false;
+	/** Cache-age fade, zero when the mode is inactive or the timewarp mode does not warp. */
+	float BaseWeight = 0.0f;
+	double AgeMs = 0.0;
+};
+
+static FCachedWarpGate EvaluateCachedWarpGate_RenderThread(const FAsyncReprojectionCVarState& CVarState, const FAsyncReprojectionCachedFrameConstants& CachedConstants)
+{
+	const float RefreshHz = FAsyncReprojectionCameraTracker::Get().GetTrackedRefreshHz();
+	const float FPS = FAsyncReprojectionCameraTracker::Get().GetTrackedFPS();
+	const float FPSStdDev = FAsyncReprojectionCameraTracker::Get().GetTrackedFPSStdDev();
+
+	FCachedWarpGate Gate;
+	Gate.bModeActive = (CVarState.Mode == EAsyncReprojectionMode::On);
+	if (CVarState.Mode == EAsyncReprojectionMode::Auto)
 	{
-		return;
+		const bool bHasRefresh = RefreshHz > 1.0f;
+		const bool bRefreshDeltaOk = bHasRefresh && (RefreshHz - FPS) >= CVarState.AutoMinRefreshDeltaHz;
+		const bool bStable = FPSStdDev <= CVarState.AutoMaxFPSStdDev;
+		const bool bWarpQualityOk = FAsyncReprojectionWarpMetrics::Get().IsWithinAutoLimits_AnyThread(CVarState);
+		Gate.bModeActive = bRefreshDeltaOk && bStable && bWarpQualityOk;
+		Gate.bAutoWarpLimit = true;
 	}
-	if (CVarState.TimewarpMode == EAsyncReprojectionTimewarpMode::FullRender || CVarState.TimewarpMode == EAsyncReprojectionTimewarpMode::DecimatedNoWarp)
+
+	Gate.AgeMs = (FPlatformTime::Seconds() - CachedConstants.CaptureTimeSeconds) * 1000.0;
+
+	float CacheFade = 1.0f;
+	if (CVarState.AsyncPresentMaxCacheAgeMs > 0)
 	{
-		return;
+		CacheFade = float(FMath::Clamp(1.0 - (Gate.AgeMs / double(CVarState.AsyncPresentMaxCacheAgeMs)), 0.0, 1.0));
 	}
 
-	if (!FAsyncReprojectionAsyncPresent::Get().ShouldSkipWorldRendering())
+	Gate.BaseWeight = CacheFade;
+	if (!Gate.bModeActive || CVarState.TimewarpMode == EAsyncReprojectionTimewarpMode::DecimatedNoWarp)
 	{
-		return;
+		Gate.BaseWeight = 0.0f;
 	}
 
-	TRefCountPtr<IPooledRenderTarget> CachedColor;
-	TRefCountPtr<IPooledRenderTarget> CachedDepthDeviceZ;
-	FAsyncReprojectionCachedFrameConstants CachedConstants;
-	if (!FAsyncReprojectionFrameCache::Get().GetCachedFrame_RenderThread(0, CachedColor, CachedDepthDeviceZ, CachedConstants))
+	return Gate;
+}
+
+/** Fills the warp constants that come straight from the capture. */
+static void FillCachedWarpFrameConstants(AsyncReprojectionWarpPrivate::FCachedWarpPlayerSource& Source)
+{
+	const FAsyncReprojectionCachedFrameConstants& CachedConstants = Source.CachedConstants;
+
+	const FIntRect ViewRect = CachedConstants.ViewRect.IsEmpty()
+		? FIntRect(FIntPoint::ZeroValue, CachedConstants.BufferExtent)
+		: CachedConstants.ViewRect;
+	const FIntRect OutputRect = CachedConstants.OutputRect.IsEmpty() ? ViewRect : CachedConstants.OutputRect;
+
+	AsyncReprojectionWarpPrivate::FCachedWarpPlayerConstants& WarpConstants = Source.WarpConstants;
+	WarpConstants.RenderedSVPositionToTranslatedWorld = CachedConstants.RenderedSVPositionToTranslatedWorld;
+	WarpConstants.TranslatedWorldToLatestClip = FMatrix44f::Identity;
+	WarpConstants.DeltaRotationInv4x4 = FMatrix44f::Identity;
+	WarpConstants.ViewToClip = CachedConstants.ViewToClip;
+	WarpConstants.ClipToView = CachedConstants.ClipToView;
+	WarpConstants.ViewRectMinAndSize = FVector4f(float(ViewRect.Min.X), float(ViewRect.Min.Y), float(ViewRect.Width()), float(ViewRect.Height()));
+	WarpConstants.BufferSizeAndInvSize = FVector4f(float(CachedConstants.BufferExtent.X), float(CachedConstants.BufferExtent.Y), 1.0f / float(CachedConstants.BufferExtent.X), 1.0f / float(CachedConstants.BufferExtent.Y));
+	WarpConstants.OutputRectMinAndSize = FVector4f(float(OutputRect.Min.X), float(OutputRect.Min.Y), float(OutputRect.Width()), float(OutputRect.Height()));
+	WarpConstants.WarpWeight = 0.0f;
+	WarpConstants.ObjectMotionSeconds = 0.0f;
+	WarpConstants.OverscanScale = FMath::Max(1.0f, CachedConstants.OverscanScale);
+	WarpConstants.FarFieldEnabled = Source.CachedFarField.IsValid() ? 1.0f : 0.0f;
+}
+
+static FVector4f QuatToVector4f(const FQuat& Quat)
+{
+	return FVector4f(float(Quat.X), float(Quat.Y), float(Quat.Z), float(Quat.W));
+}
+
+static void SetCachedWarpPoseLatestCamera(AsyncReprojectionWarpPrivate::FCachedWarpPoseLatch& Latch, const FAsyncReprojectionCameraSnapshot& LatestCamera)
+{
+	Latch.PoseInputs.LatestRotation = QuatToVector4f(LatestCamera.CameraTransform.GetRotation());
+	Latch.PoseInputs.LatestLocationOffset = FVector4f(FVector3f(LatestCamera.CameraTransform.GetLocation() - Latch.RenderedLocation), 0.0f);
+}
+
+static void SetCachedWarpPoseInputTotals(AsyncReprojectionWarpPrivate::FCachedWarpPoseLatch& Latch, const FAsyncReprojectionInputTotals& CurrentTotals)
+{
+	const FVector2f TurnDegrees = CurrentTotals.GetTurnDegreesSince(Latch.RenderedInputTotals, Latch.InputDegreesPerPixel.X, Latch.InputDegreesPerPixel.Y);
+	Latch.PoseInputs.InputTurnDegrees.X = TurnDegrees.X;
+	Latch.PoseInputs.InputTurnDegrees.Y = TurnDegrees.Y;
+}
+
+/**
+ * Re-reads the latest camera and input totals of a pose latch; called when the graph uploads the pose buffer, which may
+ * be on an RDG setup task rather than the rendering thread.
+ */
+static void LatchCachedWarpPose_AnyThread(
+	const FAsyncReprojectionCVarState& CVarState,
+	const FAsyncReprojectionCameraTracker::FPinnedPoseProvider& PoseProvider,
+	AsyncReprojectionWarpPrivate::FCachedWarpPoseLatch& Latch)
+{
+	if (Latch.bLatchLatestCamera)
 	{
-		FAsyncReprojectionAsyncPresent::Get().ReportCacheMiss_RenderThread();
-		if ((GFrameCounterRenderThread - AsyncReprojectionWarpPrivate::LastCachedPreSlateWarnFrame) >= AsyncReprojectionWarpPrivate::VerboseLogFrameInterval)
+		const FAsyncReprojectionCameraSnapshot LatestCamera = FAsyncReprojectionCameraTracker::Get().GetLatestCamera_AnyThread(Latch.PlayerIndex, CVarState, PoseProvider);
+		if (LatestCamera.bIsValid)
 		{
-			UE_LOG(LogAsyncReprojection, Warning, TEXT("AsyncPresent PreSlate warp skipped: cached frame is not available."));
-			AsyncReprojectionWarpPrivate::LastCachedPreSlateWarnFrame = GFrameCounterRenderThread;
+			SetCachedWarpPoseLatestCamera(Latch, LatestCamera);
 		}
-		return;
 	}
 
-	if (!CachedConstants.bValid || !CachedColor.IsValid() || !CachedDepthDeviceZ.IsValid())
+	if (Latch.bInputDriven)
 	{
-		FAsyncReprojectionAsyncPresent::Get().ReportCacheMiss_RenderThread();
-		if ((GFrameCounterRenderThread - AsyncReprojectionWarpPrivate::LastCachedPreSlateWarnFrame) >= AsyncReprojectionWarpPrivate::VerboseLogFrameInterval)
-		{
-			UE_LOG(LogAsyncReprojection, Error, TEXT("AsyncPresent PreSlate warp skipped: cached frame resources are invalid."));
-			AsyncReprojectionWarpPrivate::LastCachedPreSlateWarnFrame = GFrameCounterRenderThread;
-		}
-		return;
+		SetCachedWarpPoseInputTotals(Latch, FAsyncReprojectionCameraTracker::Get().GetInputTotals_AnyThread(Latch.PlayerIndex));
 	}
+}
 
-	const float RefreshHz = FAsyncReprojectionCameraTracker::Get().GetTrackedRefreshHz();
-	const float FPS = FAsyncReprojectionCameraTracker::Get().GetTrackedFPS();
-	const float FPSStdDev = FAsyncReprojectionCameraTracker::Get().GetTrackedFPSStdDev();
-
-	const FAsyncReprojectionCameraSnapshot LatestCamera = FAsyncReprojectionCameraTracker::Get().GetLatestCamera(0);
-	if (!LatestCamera.bIsValid)
+/** Records the raw poses of one player for the GPUWarpParams compute pass instead of deriving its warp matrices. */
+static void BuildCachedWarpPoseLatch_RenderThread(
+	const FAsyncReprojectionCVarState& CVarState,
+	const FAsyncReprojectionCameraSnapshot& LatestCamera,
+	const FAsyncReprojectionRenderedViewSnapshot& RenderedViewSnapshot,
+	const FCachedWarpGate& Gate,
+	AsyncReprojectionWarpPrivate::FCachedWarpPlayerSource& Source)
+{
+	using namespace AsyncReprojectionWarpPrivate;
+
+	const FAsyncReprojectionCachedFrameConstants& CachedConstants = Source.CachedConstants;
+
+	FCachedWarpPoseLatch& Latch = Source.PoseLatch;
+	Latch.PlayerIndex = Source.PlayerIndex;
+	Latch.bLatchLatestCamera = !CachedConstants.bStereoEye;
+	Latch.bInputDriven = CVarState.bInputDrivenPose && RenderedViewSnapshot.bIsValid;
+	Latch.RenderedLocation = CachedConstants.RenderedLocation;
+	Latch.RenderedInputTotals = RenderedViewSnapshot.InputTotals;
+	Latch.InputDegreesPerPixel = FVector2f(CVarState.InputYawDegreesPerPixel, CVarState.InputPitchDegreesPerPixel);
+
+	FCachedWarpPoseInputs& PoseInputs = Latch.PoseInputs;
+	PoseInputs.RenderedRotation = QuatToVector4f(CachedConstants.RenderedRotation);
+	PoseInputs.RenderedTranslatedOrigin = FVector4f(FVector3f(CachedConstants.RenderedLocation + CachedConstants.PreViewTranslation), 0.0f);
+	PoseInputs.InputTurnDegrees = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+	PoseInputs.MaxDeltaPerFrame = FVector4f(CVarState.MaxPitchDegreesPerFrame, CVarState.MaxYawDegreesPerFrame, CVarState.MaxRollDegreesPerFrame, CVarState.MaxTranslationCmPerFrame);
+	PoseInputs.AutoMaxWarp = FVector4f(CVarState.AutoMaxWarpDegrees, CVarState.AutoMaxTranslationCm, 0.0f, 0.0f);
+	PoseInputs.BaseWeight = Gate.BaseWeight;
+	PoseInputs.ObjectMotionSeconds = float(FMath::Clamp(Gate.AgeMs, 0.0, double(FMath::Max(0, CVarState.AsyncPresentObjectMotionMaxMs)))) / 1000.0f;
+	PoseInputs.Flags = 0;
+	if (CVarState.bEnableRotationWarp)
 	{
-		FAsyncReprojectionAsyncPresent::Get().ReportCacheMiss_RenderThread();
-		if ((GFrameCounterRenderThread - AsyncReprojectionWarpPrivate::LastCachedPreSlateWarnFrame) >= AsyncReprojectionWarpPrivate::VerboseLogFrameInterval)
-		{
-			UE_LOG(LogAsyncReprojection, Warning, TEXT("AsyncPresent PreSlate warp skipped: latest camera is invalid."));
-			AsyncReprojectionWarpPrivate::LastCachedPreSlateWarnFrame = GFrameCounterRenderThread;
-		}
-		return;
+		PoseInputs.Flags |= CachedWarpPoseFlagRotation;
+	}
+	if (CVarState.bEnableTranslationWarp && CVarState.bAsyncPresentReprojectMovement)
+	{
+		PoseInputs.Flags |= CachedWarpPoseFlagTranslation;
+	}
+	if (Gate.bAutoWarpLimit)
+	{
+		PoseInputs.Flags |= CachedWarpPoseFlagAutoWarpLimit;
 	}
 
-	FTextureRHIRef BackBufferTextureRHI = RHIGetViewportBackBuffer(ViewportRHI);
-	if (!BackBufferTextureRHI.IsValid())
+	SetCachedWarpPoseLatestCamera(Latch, LatestCamera);
+	if (Latch.bInputDriven)
 	{
-		FAsyncReprojectionAsyncPresent::Get().ReportCacheMiss_RenderThread();
-		if ((GFrameCounterRenderThread - AsyncReprojectionWarpPrivate::LastCachedPreSlateWarnFrame) >= AsyncReprojectionWarpPrivate::VerboseLogFrameInterval)
-		{
-			UE_LOG(LogAsyncReprojection, Error, TEXT("AsyncPresent PreSlate warp skipped: viewport back buffer is invalid."));
-			AsyncReprojectionWarpPrivate::LastCachedPreSlateWarnFrame = GFrameCounterRenderThread;
-		}
-		return;
+		SetCachedWarpPoseInputTotals(Latch, FAsyncReprojectionCameraTracker::Get().GetInputTotals_AnyThread(Source.PlayerIndex));
 	}
+}
 
-	FRDGBuilder GraphBuilder(RHICmdList);
+/**
+ * Derives one player's clamped warp constants from its cached frame and latest camera.
+ * Returns false when the PreSlate path should leave that player's view untouched this present.
+ */
+static bool BuildCachedWarpPlayerConstants_RenderThread(
+	const FAsyncReprojectionCVarState& CVarState,
+	ECachedWarpPresentPath PresentPath,
+	const FAsyncReprojectionCameraSnapshot& LatestCamera,
+	AsyncReprojectionWarpPrivate::FCachedWarpPlayerSource& Source)
+{
+	const FAsyncReprojectionCachedFrameConstants& CachedConstants = Source.CachedConstants;
 
-	FRDGTextureRef BackBufferRDG = GraphBuilder.RegisterExternalTexture(CreateRenderTarget(BackBufferTextureRHI, TEXT("AsyncReprojection.PreSlateBackBuffer")));
+	const FCachedWarpGate Gate = EvaluateCachedWarpGate_RenderThread(CVarState, CachedConstants);
+	FillCachedWarpFrameConstants(Source);
 
-	FRDGTextureRef CachedColorRDG = GraphBuilder.RegisterExternalTexture(CachedColor, TEXT("AsyncReprojection.CachedColorRT"));
-	FRDGTextureRef CachedDepthRDG = GraphBuilder.RegisterExternalTexture(CachedDepthDeviceZ, TEXT("AsyncReprojection.CachedDepthDeviceZRT"));
+	const FAsyncReprojectionRenderedViewSnapshot RenderedViewSnapshot = FAsyncReprojectionCameraTracker::Get().GetLatestRenderedView_RenderThread(Source.PlayerIndex);
 
-	const FIntRect ViewRect = CachedConstants.ViewRect.IsEmpty()
-		? FIntRect(FIntPoint::ZeroValue, CachedConstants.BufferExtent)
-		: CachedConstants.ViewRect;
+	// Pose-dependent limits are applied on the GPU, so only the pose-independent gate can skip a PreSlate player here.
+	if (CVarState.bAsyncPresentGPUWarpParams)
+	{
+		if (Gate.BaseWeight <= 0.0f && PresentPath == ECachedWarpPresentPath::PreSlate)
+		{
+			return false;
+		}
+
+		BuildCachedWarpPoseLatch_RenderThread(CVarState, LatestCamera, RenderedViewSnapshot, Gate, Source);
+		return true;
+	}
 
 	const FQuat RenderedRotation = CachedConstants.RenderedRotation;
 	const FVector RenderedLocation = CachedConstants.RenderedLocation;
@@ -541,8 +998,7 @@ void FAsyncReprojectionCachedPresentWarp::AddPreSlatePassIfEnabled(FRHICommandLi
 	FRotator RawDeltaRot = RawDeltaQuat.Rotator();
 	FVector RawDeltaTranslation = LatestLocation - RenderedLocation;
 
-	const FAsyncReprojectionRenderedViewSnapshot RenderedViewSnapshot = FAsyncReprojectionCameraTracker::Get().GetLatestRenderedView_RenderThread(0);
-	const FQuat InputDeltaQuat = ComputeInputDrivenDeltaQuat_RenderThread(CVarState, RenderedViewSnapshot, RenderedRotation);
+	const FQuat InputDeltaQuat = ComputeInputDrivenDeltaQuat_RenderThread(CVarState, Source.PlayerIndex, RenderedViewSnapshot, RenderedRotation);
 	RawDeltaQuat = InputDeltaQuat * RawDeltaQuat;
 	RawDeltaRot = RawDeltaQuat.Rotator();
 
@@ -562,28 +1018,20 @@ void FAsyncReprojectionCachedPresentWarp::AddPreSlatePassIfEnabled(FRHICommandLi
 	const float AbsRoll = FMath::Abs(RawDeltaRot.Roll);
 	const float MaxRot = FMath::Max3(AbsYaw, AbsPitch, AbsRoll);
 
-	bool bActive = (CVarState.Mode == EAsyncReprojectionMode::On);
-	if (CVarState.Mode == EAsyncReprojectionMode::Auto)
+	bool bActive = Gate.bModeActive;
+	if (Gate.bAutoWarpLimit)
 	{
-		const bool bHasRefresh = RefreshHz > 1.0f;
-		const bool bRefreshDeltaOk = bHasRefresh && (RefreshHz - FPS) >= CVarState.AutoMinRefreshDeltaHz;
-		const bool bStable = FPSStdDev <= CVarState.AutoMaxFPSStdDev;
 		const bool bWarpSmall = (MaxRot <= CVarState.AutoMaxWarpDegrees) && (TranslationMag <= CVarState.AutoMaxTranslationCm);
-		bActive = bRefreshDeltaOk && bStable && bWarpSmall;
-	}
-	if (!bActive)
-	{
-		return;
+		bActive = bActive && bWarpSmall;
 	}
-
-	float CacheFade = 1.0f;
-	if (CVarState.AsyncPresentMaxCacheAgeMs > 0)
+	if (!bActive && PresentPath == ECachedWarpPresentPath::PreSlate)
 	{
-		const double AgeMs = (FPlatformTime::Seconds() - CachedConstants.CaptureTimeSeconds) * 1000.0;
-		CacheFade = float(FMath::Clamp(1.0 - (AgeMs / double(CVarState.AsyncPresentMaxCacheAgeMs)), 0.0, 1.0));
+		return false;
 	}
 
-	float Weight = CacheFade;
+	// The composite and foreground paths always redraw the world under the UI or the foreground, so they draw with zero
+	// weight instead of skipping.
+	float Weight = bActive ? Gate.BaseWeight : 0.0f;
 
 	const float MaxRotClamp = FMath::Max3(CVarState.MaxYawDegreesPerFrame, CVarState.MaxPitchDegreesPerFrame, CVarState.MaxRollDegreesPerFrame);
 	const float MaxTransClamp = CVarState.MaxTranslationCmPerFrame;
@@ -596,15 +1044,18 @@ void FAsyncReprojectionCachedPresentWarp::AddPreSlatePassIfEnabled(FRHICommandLi
 		Weight *= FMath::Clamp(1.0f - FMath::Max(0.0f, (TranslationMag - MaxTransClamp) / (0.5f * MaxTransClamp + 1e-3f)), 0.0f, 1.0f);
 	}
 
-	if (Weight <= 0.0f)
+	Weight = FMath::Max(0.0f, Weight);
+	if (Weight <= 0.0f && PresentPath == ECachedWarpPresentPath::PreSlate)
 	{
-		return;
+		return false;
 	}
 
 	UE_LOG(
 		LogAsyncReprojection,
 		VeryVerbose,
-		TEXT("AsyncPresent PreSlate warp executing: Rotation=(P=%.3f Y=%.3f R=%.3f) TranslationCm=%.3f Weight=%.3f"),
+		TEXT("AsyncPresent %s warp executing: PlayerIndex=%d Rotation=(P=%.3f Y=%.3f R=%.3f) TranslationCm=%.3f Weight=%.3f"),
+		LexCachedWarpPresentPath(PresentPath),
+		Source.PlayerIndex,
 		RawDeltaRot.Pitch,
 		RawDeltaRot.Yaw,
 		RawDeltaRot.Roll,
@@ -627,313 +1078,759 @@ void FAsyncReprojectionCachedPresentWarp::AddPreSlatePassIfEnabled(FRHICommandLi
 	const FMatrix LatestWorldToViewRotation = FInverseRotationMatrix(ClampedLatestRotation.Rotator());
 	const FMatrix LatestTranslatedWorldToView = LatestWorldToViewRotation * FTranslationMatrix(-LatestOriginPlusPreView);
 
-		const FMatrix44f Projection = CachedConstants.ViewToClip;
-		const FMatrix LatestTranslatedWorldToClip = LatestTranslatedWorldToView * AsyncReprojectionWarpPrivate::ToFMatrix(Projection);
+	const FMatrix44f Projection = CachedConstants.ViewToClip;
+	const FMatrix LatestTranslatedWorldToClip = LatestTranslatedWorldToView * AsyncReprojectionWarpPrivate::ToFMatrix(Projection);
 
-	const bool bDoTranslation = CVarState.bEnableTranslationWarp && CVarState.bAsyncPresentReprojectMovement;
+	AsyncReprojectionWarpPrivate::FCachedWarpPlayerConstants& WarpConstants = Source.WarpConstants;
+	WarpConstants.TranslatedWorldToLatestClip = FMatrix44f(LatestTranslatedWorldToClip);
+	WarpConstants.DeltaRotationInv4x4 = FMatrix44f(FQuatRotationMatrix(UsedDeltaQuat.Inverse()));
+	WarpConstants.WarpWeight = Weight;
+	WarpConstants.ObjectMotionSeconds = float(FMath::Clamp(Gate.AgeMs, 0.0, double(FMath::Max(0, CVarState.AsyncPresentObjectMotionMaxMs)))) / 1000.0f;
+	return true;
+}
 
-	AsyncReprojectionWarpPrivate::FAsyncReprojectionCachedWarpPS::FPermutationDomain PermutationVector;
-	PermutationVector.Set<AsyncReprojectionWarpPrivate::FAsyncReprojectionCachedWarpPS::FUseTranslation>(bDoTranslation);
+/**
+ * Collects a warp source for every local player that has a usable cached frame.
+ * Returns false if any local player was missing one; the players that had one are still returned.
+ */
+static bool GatherCachedWarpPlayerSources_RenderThread(
+	const FAsyncReprojectionCVarState& CVarState,
+	ECachedWarpPresentPath PresentPath,
+	AsyncReprojectionWarpPrivate::FCachedWarpPlayerSourceArray& OutSources)
+{
+	uint64& LastWarnFrame = (PresentPath == ECachedWarpPresentPath::PreSlate)
+		? AsyncReprojectionWarpPrivate::LastCachedPreSlateWarnFrame
+		: AsyncReprojectionWarpPrivate::LastCachedBackBufferWarnFrame;
+	const bool bCanWarn = (GFrameCounterRenderThread - LastWarnFrame) >= AsyncReprojectionWarpPrivate::VerboseLogFrameInterval;
+	bool bWarned = false;
+
+	bool bAllPlayersCached = true;
+	const int32 NumPlayers = FMath::Max(1, FAsyncReprojectionCameraTracker::Get().GetNumViewSlots_AnyThread());
+	for (int32 PlayerIndex = 0; PlayerIndex < NumPlayers; PlayerIndex++)
+	{
+		AsyncReprojectionWarpPrivate::FCachedWarpPlayerSource Source;
+		Source.PlayerIndex = PlayerIndex;
+		if (!FAsyncReprojectionFrameCache::Get().AcquireCachedFrame_RenderThread(PlayerIndex, Source.CachedColor, Source.CachedDepthDeviceZ, Source.CachedConstants))
+		{
+			bAllPlayersCached = false;
+			if (bCanWarn)
+			{
+				UE_LOG(LogAsyncReprojection, Warning, TEXT("AsyncPresent %s warp skipped PlayerIndex=%d: cached frame is not available."), LexCachedWarpPresentPath(PresentPath), PlayerIndex);
+				bWarned = true;
+			}
+			continue;
+		}
 
-	TShaderMapRef<FScreenPassVS> VertexShader(GetGlobalShaderMap(CachedConstants.FeatureLevel));
-	TShaderMapRef<AsyncReprojectionWarpPrivate::FAsyncReprojectionCachedWarpPS> PixelShader(GetGlobalShaderMap(CachedConstants.FeatureLevel), PermutationVector);
+		if (!Source.CachedConstants.bValid || !Source.CachedColor.IsValid() || !Source.CachedDepthDeviceZ.IsValid())
+		{
+			bAllPlayersCached = false;
+			if (bCanWarn)
+			{
+				UE_LOG(LogAsyncReprojection, Error, TEXT("AsyncPresent %s warp skipped PlayerIndex=%d: cached frame resources are invalid."), LexCachedWarpPresentPath(PresentPath), PlayerIndex);
+				bWarned = true;
+			}
+			continue;
+		}
 
-	AsyncReprojectionWarpPrivate::FAsyncReprojectionCachedWarpPS::FParameters* PassParameters =
-		GraphBuilder.AllocParameters<AsyncReprojectionWarpPrivate::FAsyncReprojectionCachedWarpPS::FParameters>();
+		FAsyncReprojectionCameraSnapshot LatestCamera;
+		if (Source.CachedConstants.bStereoEye)
+		{
+			FAsyncReprojectionHeadPose RenderedHead;
+			RenderedHead.bIsValid = Source.CachedConstants.bRenderedHeadValid;
+			RenderedHead.Rotation = Source.CachedConstants.RenderedHeadRotation;
+			RenderedHead.Location = Source.CachedConstants.RenderedHeadLocation;
+
+			LatestCamera = FAsyncReprojectionStereo::ComputeLatestEyeCamera(
+				RenderedHead,
+				FAsyncReprojectionStereo::Get().GetLatestHeadPose_RenderThread(CVarState),
+				Source.CachedConstants.RenderedRotation,
+				Source.CachedConstants.RenderedLocation);
+		}
+		else
+		{
+			LatestCamera = FAsyncReprojectionCameraTracker::Get().GetLatestCamera_RenderThread(PlayerIndex, CVarState);
+		}
 
-	PassParameters->CachedColorTexture = CachedColorRDG;
-	PassParameters->CachedColorSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
-	PassParameters->CachedDepthDeviceZTexture = CachedDepthRDG;
-	PassParameters->CachedDepthSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+		if (!LatestCamera.bIsValid)
+		{
+			if (PresentPath == ECachedWarpPresentPath::PreSlate)
+			{
+				bAllPlayersCached = false;
+				if (bCanWarn)
+				{
+					UE_LOG(LogAsyncReprojection, Warning, TEXT("AsyncPresent PreSlate warp skipped PlayerIndex=%d: latest camera is invalid."), PlayerIndex);
+					bWarned = true;
+				}
+				continue;
+			}
 
-	PassParameters->RenderedSVPositionToTranslatedWorld = CachedConstants.RenderedSVPositionToTranslatedWorld;
-	PassParameters->TranslatedWorldToLatestClip = FMatrix44f(LatestTranslatedWorldToClip);
-	PassParameters->DeltaRotationInv4x4 = FMatrix44f(FQuatRotationMatrix(UsedDeltaQuat.Inverse()));
-	PassParameters->ViewToClip = CachedConstants.ViewToClip;
-	PassParameters->ClipToView = CachedConstants.ClipToView;
+			if (bCanWarn)
+			{
+				UE_LOG(LogAsyncReprojection, Warning, TEXT("AsyncPresent BackBuffer warp PlayerIndex=%d: latest camera is invalid, using rendered camera fallback."), PlayerIndex);
+				bWarned = true;
+			}
 
-		PassParameters->ViewRectMinAndSize = FVector4f(float(ViewRect.Min.X), float(ViewRect.Min.Y), float(ViewRect.Width()), float(ViewRect.Height()));
-		PassParameters->BufferSizeAndInvSize = FVector4f(float(CachedConstants.BufferExtent.X), float(CachedConstants.BufferExtent.Y), 1.0f / float(CachedConstants.BufferExtent.X), 1.0f / float(CachedConstants.BufferExtent.Y));
-		PassParameters->WarpWeight = Weight;
-		PassParameters->CachedInvSize = FVector2f(1.0f / float(CachedConstants.BufferExtent.X), 1.0f / float(CachedConstants.BufferExtent.Y));
-		PassParameters->StretchBorders = CVarState.bAsyncPresentStretchBorders ? 1u : 0u;
-		PassParameters->OcclusionFallback = CVarState.bAsyncPresentOcclusionFallback ? 1u : 0u;
-		PassParameters->DebugOverlay = CVarState.bDebugOverlay ? 1u : 0u;
-		PassParameters->RenderTargets[0] = FRenderTargetBinding(BackBufferRDG, ERenderTargetLoadAction::ELoad);
+			LatestCamera.bIsValid = true;
+			LatestCamera.CameraTransform = FTransform(Source.CachedConstants.RenderedRotation, Source.CachedConstants.RenderedLocation);
+		}
 
-	const FScreenPassTextureViewport Viewport(ViewRect);
-	const FScreenPassViewInfo ViewInfo(CachedConstants.FeatureLevel);
+		if (CVarState.bAsyncPresentObjectMotion)
+		{
+			FAsyncReprojectionFrameCache::Get().GetCachedObjectMotion_RenderThread(PlayerIndex, Source.CachedObjectMotion);
+		}
 
-	AddDrawScreenPass(
-		GraphBuilder,
-		RDG_EVENT_NAME("AsyncReprojection AsyncPresent CachedWarp"),
-		ViewInfo,
-		Viewport,
-		Viewport,
-		VertexShader,
-		PixelShader,
-		PassParameters,
-		EScreenPassDrawFlags::None);
+		if (CVarState.bFarField)
+		{
+			FAsyncReprojectionFrameCache::Get().GetCachedFarField_RenderThread(PlayerIndex, Source.CachedFarField);
+		}
 
-	GraphBuilder.Execute();
+		if (BuildCachedWarpPlayerConstants_RenderThread(CVarState, PresentPath, LatestCamera, Source))
+		{
+			OutSources.Add(MoveTemp(Source));
+		}
+	}
+
+	if (bWarned)
+	{
+		LastWarnFrame = GFrameCounterRenderThread;
+	}
+
+	return bAllPlayersCached;
 }
 
-void FAsyncReprojectionCachedPresentWarp::AddBackBufferPassIfEnabled(FRDGBuilder& GraphBuilder, SWindow& SlateWindow, FRDGTexture* BackBuffer)
+/**
+ * Uploads the batch's raw poses and adds the compute pass that derives the pose-dependent fields of PlayerConstantsBuffer.
+ * The poses are latched again when the graph uploads the buffer, which is later than this call and may be on another
+ * thread; the pose provider is pinned now.
+ */
+static void AddCachedWarpParamsPass(
+	FRDGBuilder& GraphBuilder,
+	TArrayView<const AsyncReprojectionWarpPrivate::FCachedWarpPlayerSource> Batch,
+	FRDGBufferRef PlayerConstantsBuffer)
 {
-	(void)SlateWindow;
+	using namespace AsyncReprojectionWarpPrivate;
 
-	if (BackBuffer == nullptr)
+	FCachedWarpPoseLatchArray PoseLatches;
+	for (const FCachedWarpPlayerSource& Source : Batch)
 	{
-		return;
+		PoseLatches.Add(Source.PoseLatch);
 	}
 
+	FRDGBufferRef PoseInputsBuffer = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(FCachedWarpPoseInputs), PoseLatches.Num()),
+		TEXT("AsyncReprojection.CachedWarpPoseInputs"));
+
+	// The upload callback may run off the rendering thread, so the settings and pose provider it latches with are pinned
+	// here; it only reads the camera snapshots and input totals, which are thread safe.
 	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
-	const bool bAsyncPipelineEnabled = CVarState.bAsyncPresent || CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
-	if (!bAsyncPipelineEnabled)
+	FAsyncReprojectionCameraTracker::FPinnedPoseProvider PoseProvider = FAsyncReprojectionCameraTracker::Get().PinPoseProvider_RenderThread(CVarState);
+
+	GraphBuilder.QueueBufferUpload(PoseInputsBuffer,
+		[PoseLatches = MoveTemp(PoseLatches), CVarState, PoseProvider = MoveTemp(PoseProvider)](void* Data, uint64 DataSize) mutable
+		{
+			check(DataSize >= uint64(PoseLatches.Num()) * sizeof(FCachedWarpPoseInputs));
+
+			FCachedWarpPoseInputs* PoseInputs = static_cast<FCachedWarpPoseInputs*>(Data);
+			for (int32 Slot = 0; Slot < PoseLatches.Num(); Slot++)
+			{
+				LatchCachedWarpPose_AnyThread(CVarState, PoseProvider, PoseLatches[Slot]);
+				PoseInputs[Slot] = PoseLatches[Slot].PoseInputs;
+			}
+		});
+
+	FAsyncReprojectionCachedWarpParamsCS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAsyncReprojectionCachedWarpParamsCS::FParameters>();
+	PassParameters->PoseInputs = GraphBuilder.CreateSRV(PoseInputsBuffer);
+	PassParameters->RWPlayerConstants = GraphBuilder.CreateUAV(PlayerConstantsBuffer);
+	PassParameters->NumPlayers = uint32(Batch.Num());
+
+	TShaderMapRef<FAsyncReprojectionCachedWarpParamsCS> ComputeShader(GetGlobalShaderMap(Batch[0].CachedConstants.FeatureLevel));
+	FComputeShaderUtils::AddPass(
+		GraphBuilder,
+		RDG_EVENT_NAME("AsyncReprojection CachedWarpParams (%d players)", Batch.Num()),
+		ComputeShader,
+		PassParameters,
+		FIntVector(1, 1, 1));
+}
+
+static AsyncReprojectionWarpPrivate::FCachedWarpSourceParameters MakeCachedWarpSourceParameters(
+	FRDGBuilder& GraphBuilder,
+	TArrayView<const AsyncReprojectionWarpPrivate::FCachedWarpPlayerSource> Batch,
+	bool bObjectMotion,
+	bool bFarField,
+	bool bGPUWarpParams,
+	FRDGBufferUAVRef MetricsUAV)
+{
+	using namespace AsyncReprojectionWarpPrivate;
+	check(Batch.Num() > 0 && Batch.Num() <= MaxPlayersPerCachedWarpBatch);
+
+	TArray<FCachedWarpPlayerConstants, TInlineAllocator<MaxPlayersPerCachedWarpBatch>> PlayerConstants;
+	FRDGTextureRef CachedColors[MaxPlayersPerCachedWarpBatch] = {};
+	FRDGTextureRef CachedDepths[MaxPlayersPerCachedWarpBatch] = {};
+	FRDGTextureRef CachedObjectMotions[MaxPlayersPerCachedWarpBatch] = {};
+	FRDGTextureRef FarFields[MaxPlayersPerCachedWarpBatch] = {};
+	FRDGTextureRef FirstFarField = nullptr;
+	for (int32 Slot = 0; Slot < Batch.Num(); Slot++)
 	{
-		return;
+		PlayerConstants.Add(Batch[Slot].WarpConstants);
+		CachedColors[Slot] = GraphBuilder.RegisterExternalTexture(Batch[Slot].CachedColor, TEXT("AsyncReprojection.CachedColorRT"));
+		CachedDepths[Slot] = GraphBuilder.RegisterExternalTexture(Batch[Slot].CachedDepthDeviceZ, TEXT("AsyncReprojection.CachedDepthDeviceZRT"));
+		if (bObjectMotion)
+		{
+			CachedObjectMotions[Slot] = GraphBuilder.RegisterExternalTexture(Batch[Slot].CachedObjectMotion, TEXT("AsyncReprojection.CachedObjectMotionRT"));
+		}
+		if (bFarField && Batch[Slot].CachedFarField.IsValid())
+		{
+			FarFields[Slot] = GraphBuilder.RegisterExternalTexture(Batch[Slot].CachedFarField, TEXT("AsyncReprojection.FarFieldRT"));
+			FirstFarField = FirstFarField != nullptr ? FirstFarField : FarFields[Slot];
+		}
 	}
-	if (CVarState.TimewarpMode == EAsyncReprojectionTimewarpMode::FullRender)
+
+	// Players without a far-field map alias another player's; their FarFieldEnabled constant keeps the shader from sampling it.
+	for (int32 Slot = 0; Slot < MaxPlayersPerCachedWarpBatch; Slot++)
 	{
-		return;
+		FarFields[Slot] = FarFields[Slot] != nullptr ? FarFields[Slot] : FirstFarField;
 	}
 
-	if (!FAsyncReprojectionAsyncPresent::Get().ShouldSkipWorldRendering())
+	// Unused slots alias slot 0 so every binding stays valid; no instance in this batch selects them.
+	for (int32 Slot = Batch.Num(); Slot < MaxPlayersPerCachedWarpBatch; Slot++)
 	{
-		return;
+		CachedColors[Slot] = CachedColors[0];
+		CachedDepths[Slot] = CachedDepths[0];
+		CachedObjectMotions[Slot] = CachedObjectMotions[0];
 	}
 
-	const int32 PlayerIndex = 0;
-	FRDGTextureRef BackBufferRDG = static_cast<FRDGTextureRef>(BackBuffer);
-	const FRDGTextureDesc BackBufferDesc = BackBufferRDG->Desc;
+	FRDGBufferRef PlayerConstantsBuffer = CreateStructuredBuffer(
+		GraphBuilder,
+		TEXT("AsyncReprojection.CachedWarpPlayerConstants"),
+		sizeof(FCachedWarpPlayerConstants),
+		PlayerConstants.Num(),
+		PlayerConstants.GetData(),
+		PlayerConstants.Num() * sizeof(FCachedWarpPlayerConstants));
 
-	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
-	FAsyncReprojectionFrameCache::Get().EnsurePresentFallback_RenderThread(RHICmdList, PlayerIndex, BackBufferDesc.Extent, BackBufferDesc.Format);
+	if (bGPUWarpParams)
+	{
+		AddCachedWarpParamsPass(GraphBuilder, Batch, PlayerConstantsBuffer);
+	}
 
-	TRefCountPtr<IPooledRenderTarget> CachedColor;
-	TRefCountPtr<IPooledRenderTarget> CachedDepthDeviceZ;
-	FAsyncReprojectionCachedFrameConstants CachedConstants;
-	if (!FAsyncReprojectionFrameCache::Get().GetCachedFrame_RenderThread(PlayerIndex, CachedColor, CachedDepthDeviceZ, CachedConstants))
+	FCachedWarpSourceParameters Parameters;
+	Parameters.PlayerConstants = GraphBuilder.CreateSRV(PlayerConstantsBuffer);
+	Parameters.CachedColorTexture0 = CachedColors[0];
+	Parameters.CachedColorTexture1 = CachedColors[1];
+	Parameters.CachedColorTexture2 = CachedColors[2];
+	Parameters.CachedColorTexture3 = CachedColors[3];
+	Parameters.CachedColorSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	Parameters.CachedDepthDeviceZTexture0 = CachedDepths[0];
+	Parameters.CachedDepthDeviceZTexture1 = CachedDepths[1];
+	Parameters.CachedDepthDeviceZTexture2 = CachedDepths[2];
+	Parameters.CachedDepthDeviceZTexture3 = CachedDepths[3];
+	Parameters.CachedDepthSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	if (bObjectMotion)
 	{
-		FAsyncReprojectionAsyncPresent::Get().ReportCacheMiss_RenderThread();
-		const bool bRestoredFallback = TryRestorePresentFallback(GraphBuilder, BackBuffer, PlayerIndex);
-		if (bRestoredFallback)
+		Parameters.CachedObjectMotionTexture0 = CachedObjectMotions[0];
+		Parameters.CachedObjectMotionTexture1 = CachedObjectMotions[1];
+		Parameters.CachedObjectMotionTexture2 = CachedObjectMotions[2];
+		Parameters.CachedObjectMotionTexture3 = CachedObjectMotions[3];
+		Parameters.CachedObjectMotionSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	}
+	if (bFarField)
+	{
+		check(FirstFarField != nullptr);
+		Parameters.FarFieldTexture0 = FarFields[0];
+		Parameters.FarFieldTexture1 = FarFields[1];
+		Parameters.FarFieldTexture2 = FarFields[2];
+		Parameters.FarFieldTexture3 = FarFields[3];
+		Parameters.FarFieldSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	}
+	Parameters.RWWarpMetrics = MetricsUAV;
+	return Parameters;
+}
+
+/** Draws one instanced quad per player in the batch; MainVS places each instance over that player's view rect. */
+template<typename TPixelShader, typename TPassParameters>
+static void AddCachedWarpBatchDraw(
+	FRDGBuilder& GraphBuilder,
+	FRDGEventName&& PassName,
+	TShaderMapRef<AsyncReprojectionWarpPrivate::FAsyncReprojectionCachedWarpVS> VertexShader,
+	TShaderMapRef<TPixelShader> PixelShader,
+	TPassParameters* PassParameters,
+	FIntPoint OutputExtent,
+	uint32 NumPlayers)
+{
+	GraphBuilder.AddPass(
+		Forward<FRDGEventName>(PassName),
+		PassParameters,
+		ERDGPassFlags::Raster,
+		[VertexShader, PixelShader, PassParameters, OutputExtent, NumPlayers](FRHICommandList& RHICmdList)
 		{
-			FAsyncReprojectionAsyncPresent::Get().ReportCompositeSuccess_RenderThread(FPlatformTime::Seconds());
+			RHICmdList.SetViewport(0.0f, 0.0f, 0.0f, float(OutputExtent.X), float(OutputExtent.Y), 1.0f);
+
+			FGraphicsPipelineStateInitializer GraphicsPSOInit;
+			RHICmdList.ApplyCachedRenderTargets(GraphicsPSOInit);
+			GraphicsPSOInit.BlendState = TStaticBlendState<>::GetRHI();
+			GraphicsPSOInit.RasterizerState = TStaticRasterizerState<FM_Solid, CM_None>::GetRHI();
+			GraphicsPSOInit.DepthStencilState = TStaticDepthStencilState<false, CF_Always>::GetRHI();
+			GraphicsPSOInit.BoundShaderState.VertexDeclarationRHI = GEmptyVertexDeclaration.VertexDeclarationRHI;
+			GraphicsPSOInit.BoundShaderState.VertexShaderRHI = VertexShader.GetVertexShader();
+			GraphicsPSOInit.BoundShaderState.PixelShaderRHI = PixelShader.GetPixelShader();
+			GraphicsPSOInit.PrimitiveType = PT_TriangleList;
+			SetGraphicsPipelineState(RHICmdList, GraphicsPSOInit, 0);
+
+			SetShaderParameters(RHICmdList, VertexShader, VertexShader.GetVertexShader(), PassParameters->VS);
+			SetShaderParameters(RHICmdList, PixelShader, PixelShader.GetPixelShader(), PassParameters->PS);
+
+			RHICmdList.DrawPrimitive(0, 2, NumPlayers);
+		});
+}
+
+/**
+ * Warps every gathered player's view rect into the back buffer, MaxPlayersPerCachedWarpBatch players per draw.
+ * UiTexture is only read by the composite path and ForegroundLayer only by the foreground path; MetricsBuffer, when set,
+ * receives the warp-quality counters.
+ */
+static void AddCachedWarpBatchPasses(
+	FRDGBuilder& GraphBuilder,
+	const FAsyncReprojectionCVarState& CVarState,
+	ECachedWarpPresentPath PresentPath,
+	TArrayView<const AsyncReprojectionWarpPrivate::FCachedWarpPlayerSource> Sources,
+	FRDGTextureRef BackBufferRDG,
+	FRDGTextureRef UiTexture,
+	FRDGBufferRef MetricsBuffer,
+	const AsyncReprojectionWarpPrivate::FCachedWarpForegroundLayer* ForegroundLayer = nullptr)
+{
+	using namespace AsyncReprojectionWarpPrivate;
+	check(Sources.Num() > 0);
+
+	const FIntPoint OutputExtent = BackBufferRDG->Desc.Extent;
+	const FVector4f OutputSizeAndInvSize(float(OutputExtent.X), float(OutputExtent.Y), 1.0f / float(OutputExtent.X), 1.0f / float(OutputExtent.Y));
+
+	const bool bDoTranslation = CVarState.bEnableTranslationWarp && CVarState.bAsyncPresentReprojectMovement;
+
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(Sources[0].CachedConstants.FeatureLevel);
+	TShaderMapRef<FAsyncReprojectionCachedWarpVS> VertexShader(ShaderMap);
+
+	// The counters are only incremented atomically, so the warp draws need no UAV barriers between each other.
+	FRDGBufferUAVRef MetricsUAV = MetricsBuffer != nullptr
+		? GraphBuilder.CreateUAV(FRDGBufferUAVDesc(MetricsBuffer, PF_R32_UINT), ERDGUnorderedAccessViewFlags::SkipBarrier)
+		: nullptr;
+
+	for (int32 BatchStart = 0; BatchStart < Sources.Num(); BatchStart += MaxPlayersPerCachedWarpBatch)
+	{
+		const int32 BatchCount = FMath::Min(MaxPlayersPerCachedWarpBatch, Sources.Num() - BatchStart);
+		const TArrayView<const FCachedWarpPlayerSource> Batch = Sources.Slice(BatchStart, BatchCount);
+
+		// The foreground warp has no object motion or far-field permutations; it is only seen around the foreground layer
+		// between two world frames.
+		const bool bCameraOnly = PresentPath == ECachedWarpPresentPath::Foreground;
+
+		// Object motion is a batch-wide permutation, so a player captured without it drops the batch to the camera-only warp.
+		bool bObjectMotion = CVarState.bAsyncPresentObjectMotion && !bCameraOnly;
+		for (const FCachedWarpPlayerSource& Source : Batch)
+		{
+			bObjectMotion &= Source.CachedObjectMotion.IsValid();
 		}
-		if ((GFrameCounterRenderThread - AsyncReprojectionWarpPrivate::LastCachedBackBufferWarnFrame) >= AsyncReprojectionWarpPrivate::VerboseLogFrameInterval)
+
+		// The far field is per player, so one player with a map is enough to compile it into the batch.
+		bool bFarField = false;
+		for (const FCachedWarpPlayerSource& Source : Batch)
 		{
-			UE_LOG(LogAsyncReprojection, Warning, TEXT("AsyncPresent BackBuffer warp skipped: cached frame is not available (fallback restored=%d)."), bRestoredFallback ? 1 : 0);
-			AsyncReprojectionWarpPrivate::LastCachedBackBufferWarnFrame = GFrameCounterRenderThread;
+			bFarField |= Source.CachedFarField.IsValid() && !bCameraOnly;
 		}
-		return;
-	}
 
-	if (!CachedConstants.bValid || !CachedColor.IsValid() || !CachedDepthDeviceZ.IsValid())
-	{
-		FAsyncReprojectionAsyncPresent::Get().ReportCacheMiss_RenderThread();
-		const bool bRestoredFallback = TryRestorePresentFallback(GraphBuilder, BackBuffer, PlayerIndex);
-		if (bRestoredFallback)
+		const FCachedWarpSourceParameters SourceParameters = MakeCachedWarpSourceParameters(GraphBuilder, Batch, bObjectMotion, bFarField, CVarState.bAsyncPresentGPUWarpParams, MetricsUAV);
+		const FCachedWarpPermutationDomain PermutationVector = MakeCachedWarpPermutation(CVarState, bDoTranslation, bObjectMotion, MetricsUAV != nullptr, bFarField);
+
+		if (PresentPath == ECachedWarpPresentPath::Composite)
 		{
-			FAsyncReprojectionAsyncPresent::Get().ReportCompositeSuccess_RenderThread(FPlatformTime::Seconds());
+			check(UiTexture != nullptr);
+			TShaderMapRef<FAsyncReprojectionCachedWarpCompositePS> PixelShader(ShaderMap, PermutationVector);
+
+			FCachedWarpCompositeBatchPassParameters* PassParameters = GraphBuilder.AllocParameters<FCachedWarpCompositeBatchPassParameters>();
+			PassParameters->VS.PlayerConstants = SourceParameters.PlayerConstants;
+			PassParameters->VS.OutputSizeAndInvSize = OutputSizeAndInvSize;
+			PassParameters->PS.Source = SourceParameters;
+			PassParameters->PS.UiTexture = UiTexture;
+			PassParameters->PS.UiSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+			PassParameters->PS.UiInvSize = FVector2f(OutputSizeAndInvSize.Z, OutputSizeAndInvSize.W);
+			PassParameters->PS.UiMaskThreshold = GetAsyncPresentUiMaskThreshold();
+			PassParameters->RenderTargets[0] = FRenderTargetBinding(BackBufferRDG, ERenderTargetLoadAction::ELoad);
+
+			AddCachedWarpBatchDraw(
+				GraphBuilder,
+				RDG_EVENT_NAME("AsyncReprojection AsyncPresent CachedWarpComposite (%d players)", BatchCount),
+				VertexShader,
+				PixelShader,
+				PassParameters,
+				OutputExtent,
+				uint32(BatchCount));
 		}
-		if ((GFrameCounterRenderThread - AsyncReprojectionWarpPrivate::LastCachedBackBufferWarnFrame) >= AsyncReprojectionWarpPrivate::VerboseLogFrameInterval)
+		else if (PresentPath == ECachedWarpPresentPath::Foreground)
 		{
-			UE_LOG(LogAsyncReprojection, Error, TEXT("AsyncPresent BackBuffer warp skipped: cached frame resources are invalid (fallback restored=%d)."), bRestoredFallback ? 1 : 0);
-			AsyncReprojectionWarpPrivate::LastCachedBackBufferWarnFrame = GFrameCounterRenderThread;
+			check(ForegroundLayer != nullptr && ForegroundLayer->Color != nullptr && ForegroundLayer->SceneDepth != nullptr);
+			TShaderMapRef<FAsyncReprojectionCachedWarpForegroundPS> PixelShader(ShaderMap, ToForegroundPermutation(PermutationVector));
+
+			const FIntPoint DepthExtent = ForegroundLayer->SceneDepth->Desc.Extent;
+
+			FCachedWarpForegroundBatchPassParameters* PassParameters = GraphBuilder.AllocParameters<FCachedWarpForegroundBatchPassParameters>();
+			PassParameters->VS.PlayerConstants = SourceParameters.PlayerConstants;
+			PassParameters->VS.OutputSizeAndInvSize = OutputSizeAndInvSize;
+			PassParameters->PS.Source = SourceParameters;
+			PassParameters->PS.ForegroundTexture = ForegroundLayer->Color;
+			PassParameters->PS.ForegroundDepthTexture = ForegroundLayer->SceneDepth;
+			PassParameters->PS.ForegroundDepthSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+			PassParameters->PS.ForegroundDepthInvSize = FVector2f(1.0f / float(DepthExtent.X), 1.0f / float(DepthExtent.Y));
+			for (int32 Slot = 0; Slot < MaxPlayersPerCachedWarpBatch; Slot++)
+			{
+				// A player without a foreground view this frame gets an empty rect, which the shader reads as no foreground.
+				const FIntRect* DepthRect = Slot < BatchCount && ForegroundLayer->DepthRectByViewSlot != nullptr
+					? ForegroundLayer->DepthRectByViewSlot->Find(Batch[Slot].PlayerIndex)
+					: nullptr;
+				PassParameters->PS.ForegroundDepthRectMinAndSize[Slot] = DepthRect != nullptr
+					? FVector4f(float(DepthRect->Min.X), float(DepthRect->Min.Y), float(DepthRect->Width()), float(DepthRect->Height()))
+					: FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
+			}
+			PassParameters->RenderTargets[0] = FRenderTargetBinding(BackBufferRDG, ERenderTargetLoadAction::ELoad);
+
+			AddCachedWarpBatchDraw(
+				GraphBuilder,
+				RDG_EVENT_NAME("AsyncReprojection Foreground CachedWarp (%d players)", BatchCount),
+				VertexShader,
+				PixelShader,
+				PassParameters,
+				OutputExtent,
+				uint32(BatchCount));
 		}
-		return;
-	}
-
-	FAsyncReprojectionCameraSnapshot LatestCamera = FAsyncReprojectionCameraTracker::Get().GetLatestCamera(PlayerIndex);
-	if (!LatestCamera.bIsValid)
-	{
-		if ((GFrameCounterRenderThread - AsyncReprojectionWarpPrivate::LastCachedBackBufferWarnFrame) >= AsyncReprojectionWarpPrivate::VerboseLogFrameInterval)
+		else
 		{
-			UE_LOG(LogAsyncReprojection, Warning, TEXT("AsyncPresent BackBuffer warp: latest camera is invalid, using rendered camera fallback."));
-			AsyncReprojectionWarpPrivate::LastCachedBackBufferWarnFrame = GFrameCounterRenderThread;
+			TShaderMapRef<FAsyncReprojectionCachedWarpPS> PixelShader(ShaderMap, PermutationVector);
+
+			FCachedWarpBatchPassParameters* PassParameters = GraphBuilder.AllocParameters<FCachedWarpBatchPassParameters>();
+			PassParameters->VS.PlayerConstants = SourceParameters.PlayerConstants;
+			PassParameters->VS.OutputSizeAndInvSize = OutputSizeAndInvSize;
+			PassParameters->PS.Source = SourceParameters;
+			PassParameters->RenderTargets[0] = FRenderTargetBinding(BackBufferRDG, ERenderTargetLoadAction::ELoad);
+
+			AddCachedWarpBatchDraw(
+				GraphBuilder,
+				RDG_EVENT_NAME("AsyncReprojection AsyncPresent CachedWarp (%d players)", BatchCount),
+				VertexShader,
+				PixelShader,
+				PassParameters,
+				OutputExtent,
+				uint32(BatchCount));
 		}
-
-		LatestCamera.bIsValid = true;
-		LatestCamera.CameraTransform = FTransform(CachedConstants.RenderedRotation, CachedConstants.RenderedLocation);
 	}
+}
 
-	const float RefreshHz = FAsyncReprojectionCameraTracker::Get().GetTrackedRefreshHz();
-	const float FPS = FAsyncReprojectionCameraTracker::Get().GetTrackedFPS();
-	const float FPSStdDev = FAsyncReprojectionCameraTracker::Get().GetTrackedFPSStdDev();
+void AsyncReprojectionWarpBenchmark::AddKernelPass(
+	FRDGBuilder& GraphBuilder,
+	EAsyncReprojectionBenchmarkKernel Kernel,
+	const FAsyncReprojectionBenchmarkPermutation& Permutation,
+	const FAsyncReprojectionBenchmarkView& View,
+	const FAsyncReprojectionBenchmarkTargets& Targets)
+{
+	using namespace AsyncReprojectionWarpPrivate;
 
-	const FIntRect ViewRect = CachedConstants.ViewRect.IsEmpty()
-		? FIntRect(FIntPoint::ZeroValue, CachedConstants.BufferExtent)
-		: CachedConstants.ViewRect;
+	FRDGTextureRef OutputRDG = GraphBuilder.RegisterExternalTexture(Targets.Output, TEXT("AsyncReprojection.BenchmarkOutput"));
+	const FIntRect ViewRect(FIntPoint::ZeroValue, View.Extent);
 
-	const FQuat RenderedRotation = CachedConstants.RenderedRotation;
-	const FVector RenderedLocation = CachedConstants.RenderedLocation;
+	if (Kernel == EAsyncReprojectionBenchmarkKernel::PresentWarp)
+	{
+		FRDGTextureRef ColorRDG = GraphBuilder.RegisterExternalTexture(Targets.Color, TEXT("AsyncReprojection.BenchmarkColor"));
+
+		const FScreenPassTextureViewport Viewport(View.Extent, ViewRect);
+		const FScreenPassViewInfo ViewInfo(GMaxRHIFeatureLevel);
+
+		TShaderMapRef<FScreenPassVS> VertexShader(GetGlobalShaderMap(ViewInfo.FeatureLevel));
+		TShaderMapRef<FAsyncReprojectionPresentWarpPS> PixelShader(GetGlobalShaderMap(ViewInfo.FeatureLevel));
+
+		FAsyncReprojectionPresentWarpPS::FParameters* PassParameters = GraphBuilder.AllocParameters<FAsyncReprojectionPresentWarpPS::FParameters>();
+		PassParameters->BackBufferTexture = ColorRDG;
+		PassParameters->BackBufferSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+		PassParameters->ViewRectMinAndSize = FVector4f(0.0f, 0.0f, float(View.Extent.X), float(View.Extent.Y));
+		PassParameters->ViewToClip = View.ViewToClip;
+		PassParameters->ClipToView = View.ClipToView;
+		PassParameters->DeltaRotationInv4x4 = View.DeltaRotationInv4x4;
+		PassParameters->WarpWeight = View.WarpWeight;
+		PassParameters->BackBufferInvSize = FVector2f(1.0f / float(View.Extent.X), 1.0f / float(View.Extent.Y));
+		PassParameters->RenderTargets[0] = FRenderTargetBinding(OutputRDG, ERenderTargetLoadAction::ENoAction);
+
+		AddDrawScreenPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("AsyncReprojection Benchmark PresentWarp"),
+			ViewInfo,
+			Viewport,
+			Viewport,
+			VertexShader,
+			PixelShader,
+			PassParameters,
+			EScreenPassDrawFlags::None);
+		return;
+	}
 
-	const FQuat LatestRotation = LatestCamera.CameraTransform.GetRotation();
-	const FVector LatestLocation = LatestCamera.CameraTransform.GetLocation();
+	FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
+	CVarState.bEnableTranslationWarp = Permutation.bTranslation;
+	CVarState.bAsyncPresentReprojectMovement = Permutation.bTranslation;
+	CVarState.bAsyncPresentStretchBorders = Permutation.bStretchBorders;
+	CVarState.bAsyncPresentOcclusionFallback = Permutation.bOcclusionFallback;
+	CVarState.bAsyncPresentObjectMotion = Permutation.bObjectMotion;
+	CVarState.bFarField = Permutation.bFarField;
+	CVarState.bAsyncPresentGPUWarpParams = false;
+	CVarState.bDebugOverlay = false;
+
+	FCachedWarpPlayerSource Source;
+	Source.PlayerIndex = 0;
+	Source.CachedColor = Targets.Color;
+	Source.CachedDepthDeviceZ = Targets.DeviceZ;
+	if (Permutation.bObjectMotion)
+	{
+		Source.CachedObjectMotion = Targets.ObjectMotion;
+	}
+	if (Permutation.bFarField)
+	{
+		Source.CachedFarField = Targets.FarField;
+	}
 
-	FQuat RawDeltaQuat = LatestRotation * RenderedRotation.Inverse();
-	FRotator RawDeltaRot = RawDeltaQuat.Rotator();
-	FVector RawDeltaTranslation = LatestLocation - RenderedLocation;
+	FAsyncReprojectionCachedFrameConstants& CachedConstants = Source.CachedConstants;
+	CachedConstants.bValid = true;
+	CachedConstants.ViewRect = ViewRect;
+	CachedConstants.BufferExtent = View.Extent;
+	CachedConstants.OutputRect = ViewRect;
+	CachedConstants.ViewToClip = View.ViewToClip;
+	CachedConstants.ClipToView = View.ClipToView;
+	CachedConstants.RenderedSVPositionToTranslatedWorld = View.SVPositionToTranslatedWorld;
+	CachedConstants.FeatureLevel = GMaxRHIFeatureLevel;
+
+	FillCachedWarpFrameConstants(Source);
+	Source.WarpConstants.TranslatedWorldToLatestClip = View.TranslatedWorldToLatestClip;
+	Source.WarpConstants.DeltaRotationInv4x4 = View.DeltaRotationInv4x4;
+	Source.WarpConstants.WarpWeight = View.WarpWeight;
+	Source.WarpConstants.ObjectMotionSeconds = View.ObjectMotionSeconds;
+
+	const bool bComposite = Kernel == EAsyncReprojectionBenchmarkKernel::CachedWarpComposite;
+	FRDGTextureRef UiRDG = bComposite ? GraphBuilder.RegisterExternalTexture(Targets.Ui, TEXT("AsyncReprojection.BenchmarkUi")) : nullptr;
+
+	AddCachedWarpBatchPasses(
+		GraphBuilder,
+		CVarState,
+		bComposite ? ECachedWarpPresentPath::Composite : ECachedWarpPresentPath::PreSlate,
+		MakeArrayView(&Source, 1),
+		OutputRDG,
+		UiRDG,
+		nullptr);
+}
 
-	const FAsyncReprojectionRenderedViewSnapshot RenderedViewSnapshot = FAsyncReprojectionCameraTracker::Get().GetLatestRenderedView_RenderThread(PlayerIndex);
-	const FQuat InputDeltaQuat = ComputeInputDrivenDeltaQuat_RenderThread(CVarState, RenderedViewSnapshot, RenderedRotation);
-	RawDeltaQuat = InputDeltaQuat * RawDeltaQuat;
-	RawDeltaRot = RawDeltaQuat.Rotator();
+void FAsyncReprojectionCachedPresentWarp::AddPreSlatePassesIfEnabled(FRHICommandListImmediate& RHICmdList, TConstArrayView<FRHIViewport*> Viewports)
+{
+	if (Viewports.IsEmpty())
+	{
+		return;
+	}
 
-	if (!CVarState.bEnableRotationWarp)
+	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
+	const bool bAsyncPipelineEnabled = CVarState.bAsyncPresent || CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
+	if (!bAsyncPipelineEnabled || !CVarState.bAsyncPresentAllowHUDStable)
 	{
-		RawDeltaQuat = FQuat::Identity;
-		RawDeltaRot = FRotator::ZeroRotator;
+		return;
 	}
-	if (!CVarState.bEnableTranslationWarp || !CVarState.bAsyncPresentReprojectMovement)
+	if (CVarState.TimewarpMode == EAsyncReprojectionTimewarpMode::FullRender || CVarState.TimewarpMode == EAsyncReprojectionTimewarpMode::DecimatedNoWarp)
 	{
-		RawDeltaTranslation = FVector::ZeroVector;
+		return;
 	}
 
-	const float TranslationMag = RawDeltaTranslation.Size();
-	const float AbsYaw = FMath::Abs(RawDeltaRot.Yaw);
-	const float AbsPitch = FMath::Abs(RawDeltaRot.Pitch);
-	const float AbsRoll = FMath::Abs(RawDeltaRot.Roll);
-	const float MaxRot = FMath::Max3(AbsYaw, AbsPitch, AbsRoll);
-
-	bool bActive = (CVarState.Mode == EAsyncReprojectionMode::On);
-	if (CVarState.Mode == EAsyncReprojectionMode::Auto)
+	if (!FAsyncReprojectionAsyncPresent::Get().ShouldSkipWorldRendering())
 	{
-		const bool bHasRefresh = RefreshHz > 1.0f;
-		const bool bRefreshDeltaOk = bHasRefresh && (RefreshHz - FPS) >= CVarState.AutoMinRefreshDeltaHz;
-		const bool bStable = FPSStdDev <= CVarState.AutoMaxFPSStdDev;
-		const bool bWarpSmall = (MaxRot <= CVarState.AutoMaxWarpDegrees) && (TranslationMag <= CVarState.AutoMaxTranslationCm);
-		bActive = bRefreshDeltaOk && bStable && bWarpSmall;
+		return;
 	}
 
-	float CacheFade = 1.0f;
-	if (CVarState.AsyncPresentMaxCacheAgeMs > 0)
+	// Every window presents the same cached frames, so the sources are gathered once per present.
+	AsyncReprojectionWarpPrivate::FCachedWarpPlayerSourceArray Sources;
+	if (!GatherCachedWarpPlayerSources_RenderThread(CVarState, ECachedWarpPresentPath::PreSlate, Sources))
 	{
-		const double AgeMs = (FPlatformTime::Seconds() - CachedConstants.CaptureTimeSeconds) * 1000.0;
-		CacheFade = float(FMath::Clamp(1.0 - (AgeMs / double(CVarState.AsyncPresentMaxCacheAgeMs)), 0.0, 1.0));
+		FAsyncReprojectionAsyncPresent::Get().ReportCacheMiss_RenderThread();
 	}
 
-	float Weight = CacheFade;
-	if (!bActive)
+	if (Sources.Num() == 0)
 	{
-		Weight = 0.0f;
+		return;
 	}
-	if (CVarState.TimewarpMode == EAsyncReprojectionTimewarpMode::DecimatedNoWarp)
+
+	// One graph covers every window of the present, so compilation, barrier batching and the cached texture
+	// registrations are paid once rather than per window.
+	FRDGBuilder GraphBuilder(RHICmdList);
+	RDG_GPU_STAT_SCOPE(GraphBuilder, AsyncReprojectionCachedPresent);
+
+	FRDGBufferRef MetricsBuffer = FAsyncReprojectionWarpMetrics::Get().BeginPresent_RenderThread(GraphBuilder, CVarState);
+
+	for (FRHIViewport* ViewportRHI : Viewports)
 	{
-		Weight = 0.0f;
+		if (ViewportRHI == nullptr)
+		{
+			continue;
+		}
+
+		FTextureRHIRef BackBufferTextureRHI = RHIGetViewportBackBuffer(ViewportRHI);
+		if (!BackBufferTextureRHI.IsValid())
+		{
+			FAsyncReprojectionAsyncPresent::Get().ReportCacheMiss_RenderThread();
+			if ((GFrameCounterRenderThread - AsyncReprojectionWarpPrivate::LastCachedPreSlateWarnFrame) >= AsyncReprojectionWarpPrivate::VerboseLogFrameInterval)
+			{
+				UE_LOG(LogAsyncReprojection, Error, TEXT("AsyncPresent PreSlate warp skipped: viewport back buffer is invalid."));
+				AsyncReprojectionWarpPrivate::LastCachedPreSlateWarnFrame = GFrameCounterRenderThread;
+			}
+			continue;
+		}
+
+		FRDGTextureRef BackBufferRDG = AsyncReprojectionWarpPrivate::RegisterPreSlateBackBuffer(GraphBuilder, BackBufferTextureRHI.GetReference());
+
+		AddCachedWarpBatchPasses(GraphBuilder, CVarState, ECachedWarpPresentPath::PreSlate, Sources, BackBufferRDG, nullptr, MetricsBuffer);
 	}
 
-	const float MaxRotClamp = FMath::Max3(CVarState.MaxYawDegreesPerFrame, CVarState.MaxPitchDegreesPerFrame, CVarState.MaxRollDegreesPerFrame);
-	const float MaxTransClamp = CVarState.MaxTranslationCmPerFrame;
-	if (MaxRotClamp > 0.0f)
+	FAsyncReprojectionWarpMetrics::Get().EndPresent_RenderThread(GraphBuilder, MetricsBuffer);
+	GraphBuilder.Execute();
+}
+
+bool FAsyncReprojectionCachedPresentWarp::PresentCachedFrame_RenderThread(FRHICommandListImmediate& RHICmdList, FRHIViewport* ViewportRHI, const FAsyncReprojectionCVarState& CVarState, bool bLockToVsync)
+{
+	check(ViewportRHI != nullptr);
+
+	AsyncReprojectionWarpPrivate::FCachedWarpPlayerSourceArray Sources;
+	GatherCachedWarpPlayerSources_RenderThread(CVarState, ECachedWarpPresentPath::PreSlate, Sources);
+	if (Sources.Num() == 0)
 	{
-		Weight *= FMath::Clamp(1.0f - FMath::Max(0.0f, (MaxRot - MaxRotClamp) / (0.5f * MaxRotClamp + 1e-3f)), 0.0f, 1.0f);
+		return false;
 	}
-	if (MaxTransClamp > 0.0f)
+
+	RHICmdList.BeginDrawingViewport(ViewportRHI, nullptr);
+
+	FTextureRHIRef BackBufferTextureRHI = RHIGetViewportBackBuffer(ViewportRHI);
+	if (!BackBufferTextureRHI.IsValid())
 	{
-		Weight *= FMath::Clamp(1.0f - FMath::Max(0.0f, (TranslationMag - MaxTransClamp) / (0.5f * MaxTransClamp + 1e-3f)), 0.0f, 1.0f);
+		RHICmdList.EndDrawingViewport(ViewportRHI, false, bLockToVsync);
+		return false;
 	}
 
-	Weight = FMath::Max(0.0f, Weight);
+	{
+		FRDGBuilder GraphBuilder(RHICmdList);
+		RDG_GPU_STAT_SCOPE(GraphBuilder, AsyncReprojectionCachedPresent);
 
-	UE_LOG(
-		LogAsyncReprojection,
-		VeryVerbose,
-		TEXT("AsyncPresent BackBuffer warp executing: Rotation=(P=%.3f Y=%.3f R=%.3f) TranslationCm=%.3f Weight=%.3f"),
-		RawDeltaRot.Pitch,
-		RawDeltaRot.Yaw,
-		RawDeltaRot.Roll,
-		TranslationMag,
-		Weight);
+		FRDGBufferRef MetricsBuffer = FAsyncReprojectionWarpMetrics::Get().BeginPresent_RenderThread(GraphBuilder, CVarState);
 
-	FRotator ClampedRot = RawDeltaRot;
-	ClampedRot.Yaw = FMath::Clamp(ClampedRot.Yaw, -CVarState.MaxYawDegreesPerFrame, CVarState.MaxYawDegreesPerFrame);
-	ClampedRot.Pitch = FMath::Clamp(ClampedRot.Pitch, -CVarState.MaxPitchDegreesPerFrame, CVarState.MaxPitchDegreesPerFrame);
-	ClampedRot.Roll = FMath::Clamp(ClampedRot.Roll, -CVarState.MaxRollDegreesPerFrame, CVarState.MaxRollDegreesPerFrame);
+		FRDGTextureRef BackBufferRDG = AsyncReprojectionWarpPrivate::RegisterPreSlateBackBuffer(GraphBuilder, BackBufferTextureRHI.GetReference());
 
-	const FVector ClampedTranslation = (MaxTransClamp > 0.0f) ? RawDeltaTranslation.GetClampedToMaxSize(MaxTransClamp) : RawDeltaTranslation;
+		// The swap-chain image still holds an older frame with its UI; only the warped view rects are presented.
+		AddClearRenderTargetPass(GraphBuilder, BackBufferRDG, FLinearColor::Black);
+		AddCachedWarpBatchPasses(GraphBuilder, CVarState, ECachedWarpPresentPath::PreSlate, Sources, BackBufferRDG, nullptr, MetricsBuffer);
+		GraphBuilder.SetTextureAccessFinal(BackBufferRDG, ERHIAccess::Present);
 
-	const FQuat UsedDeltaQuat = ClampedRot.Quaternion();
+		FAsyncReprojectionWarpMetrics::Get().EndPresent_RenderThread(GraphBuilder, MetricsBuffer);
+		GraphBuilder.Execute();
+	}
 
-	const FVector ClampedLatestLocation = RenderedLocation + ClampedTranslation;
-	const FQuat ClampedLatestRotation = UsedDeltaQuat * RenderedRotation;
+	RHICmdList.EndDrawingViewport(ViewportRHI, true, bLockToVsync);
+	return true;
+}
 
-	const FVector LatestOriginPlusPreView = ClampedLatestLocation + CachedConstants.PreViewTranslation;
-	const FMatrix LatestWorldToViewRotation = FInverseRotationMatrix(ClampedLatestRotation.Rotator());
-	const FMatrix LatestTranslatedWorldToView = LatestWorldToViewRotation * FTranslationMatrix(-LatestOriginPlusPreView);
+bool FAsyncReprojectionCachedPresentWarp::AddForegroundCompositePasses_RenderThread(
+	FRDGBuilder& GraphBuilder,
+	const FAsyncReprojectionCVarState& CVarState,
+	FRDGTextureRef ViewFamilyTexture,
+	FRDGTextureRef SceneDepth,
+	const TMap<int32, FIntRect>& DepthRectByViewSlot)
+{
+	check(ViewFamilyTexture != nullptr && SceneDepth != nullptr);
 
-	const FMatrix44f Projection = CachedConstants.ViewToClip;
-	const FMatrix LatestTranslatedWorldToClip = LatestTranslatedWorldToView * AsyncReprojectionWarpPrivate::ToFMatrix(Projection);
+	// Like the composite path, a player without a cached frame would leave its pane showing only the foreground.
+	AsyncReprojectionWarpPrivate::FCachedWarpPlayerSourceArray Sources;
+	const bool bAllPlayersCached = GatherCachedWarpPlayerSources_RenderThread(CVarState, ECachedWarpPresentPath::Foreground, Sources);
+	if (!bAllPlayersCached || Sources.Num() == 0)
+	{
+		return false;
+	}
 
-	const bool bDoTranslation = CVarState.bEnableTranslationWarp && CVarState.bAsyncPresentReprojectMovement;
+	RDG_GPU_STAT_SCOPE(GraphBuilder, AsyncReprojectionCachedPresent);
 
-	FRDGTextureRef UiCopy = GraphBuilder.CreateTexture(BackBufferDesc, TEXT("AsyncReprojection.AsyncPresent.UiCopy"));
-	AddCopyTexturePass(GraphBuilder, BackBufferRDG, UiCopy);
+	AsyncReprojectionWarpPrivate::FCachedWarpForegroundLayer ForegroundLayer;
+	ForegroundLayer.Color = GraphBuilder.CreateTexture(ViewFamilyTexture->Desc, TEXT("AsyncReprojection.ForegroundColor"));
+	ForegroundLayer.SceneDepth = SceneDepth;
+	ForegroundLayer.DepthRectByViewSlot = &DepthRectByViewSlot;
+	AddCopyTexturePass(GraphBuilder, ViewFamilyTexture, ForegroundLayer.Color);
+
+	FRDGBufferRef MetricsBuffer = FAsyncReprojectionWarpMetrics::Get().BeginPresent_RenderThread(GraphBuilder, CVarState);
+	AddCachedWarpBatchPasses(GraphBuilder, CVarState, ECachedWarpPresentPath::Foreground, Sources, ViewFamilyTexture, nullptr, MetricsBuffer, &ForegroundLayer);
+	FAsyncReprojectionWarpMetrics::Get().EndPresent_RenderThread(GraphBuilder, MetricsBuffer);
+	return true;
+}
 
-	FRDGTextureRef CachedColorRDG = GraphBuilder.RegisterExternalTexture(CachedColor, TEXT("AsyncReprojection.CachedColorRT"));
-	FRDGTextureRef CachedDepthRDG = GraphBuilder.RegisterExternalTexture(CachedDepthDeviceZ, TEXT("AsyncReprojection.CachedDepthDeviceZRT"));
+void FAsyncReprojectionCachedPresentWarp::AddBackBufferPassIfEnabled(FRDGBuilder& GraphBuilder, SWindow& SlateWindow, FRDGTexture* BackBuffer)
+{
+	(void)SlateWindow;
 
-	AsyncReprojectionWarpPrivate::FAsyncReprojectionCachedWarpCompositePS::FPermutationDomain PermutationVector;
-	PermutationVector.Set<AsyncReprojectionWarpPrivate::FAsyncReprojectionCachedWarpCompositePS::FUseTranslation>(bDoTranslation);
+	if (BackBuffer == nullptr)
+	{
+		return;
+	}
 
-	TShaderMapRef<FScreenPassVS> VertexShader(GetGlobalShaderMap(CachedConstants.FeatureLevel));
-	TShaderMapRef<AsyncReprojectionWarpPrivate::FAsyncReprojectionCachedWarpCompositePS> PixelShader(GetGlobalShaderMap(CachedConstants.FeatureLevel), PermutationVector);
+	const FAsyncReprojectionCVarState CVarState = FAsyncReprojectionCVars::Get();
+	const bool bAsyncPipelineEnabled = CVarState.bAsyncPresent || CVarState.TimewarpMode != EAsyncReprojectionTimewarpMode::FullRender;
+	if (!bAsyncPipelineEnabled)
+	{
+		return;
+	}
+	if (CVarState.TimewarpMode == EAsyncReprojectionTimewarpMode::FullRender)
+	{
+		return;
+	}
 
-	AsyncReprojectionWarpPrivate::FAsyncReprojectionCachedWarpCompositePS::FParameters* PassParameters =
-		GraphBuilder.AllocParameters<AsyncReprojectionWarpPrivate::FAsyncReprojectionCachedWarpCompositePS::FParameters>();
+	// Foreground-only frames were composited by the view family and the back buffer already holds the result.
+	if (!FAsyncReprojectionAsyncPresent::Get().ShouldSkipWorldRendering() || FAsyncReprojectionAsyncPresent::Get().IsForegroundOnlyFrame())
+	{
+		return;
+	}
 
-	PassParameters->CachedColorTexture = CachedColorRDG;
-	PassParameters->CachedColorSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
-	PassParameters->CachedDepthDeviceZTexture = CachedDepthRDG;
-	PassParameters->CachedDepthSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	// The fallback snapshots the whole shared back buffer, so it is kept in the first player's slot.
+	const int32 FallbackPlayerIndex = 0;
+	FRDGTextureRef BackBufferRDG = static_cast<FRDGTextureRef>(BackBuffer);
+	const FRDGTextureDesc BackBufferDesc = BackBufferRDG->Desc;
 
-	PassParameters->UiTexture = UiCopy;
-	PassParameters->UiSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	FRHICommandListImmediate& RHICmdList = FRHICommandListExecutor::GetImmediateCommandList();
+	FAsyncReprojectionFrameCache::Get().EnsurePresentFallback_RenderThread(RHICmdList, FallbackPlayerIndex, BackBufferDesc.Extent, BackBufferDesc.Format);
 
-	PassParameters->RenderedSVPositionToTranslatedWorld = CachedConstants.RenderedSVPositionToTranslatedWorld;
-	PassParameters->TranslatedWorldToLatestClip = FMatrix44f(LatestTranslatedWorldToClip);
-	PassParameters->DeltaRotationInv4x4 = FMatrix44f(FQuatRotationMatrix(UsedDeltaQuat.Inverse()));
-	PassParameters->ViewToClip = CachedConstants.ViewToClip;
-	PassParameters->ClipToView = CachedConstants.ClipToView;
+	AsyncReprojectionWarpPrivate::FCachedWarpPlayerSourceArray Sources;
+	const bool bAllPlayersCached = GatherCachedWarpPlayerSources_RenderThread(CVarState, ECachedWarpPresentPath::Composite, Sources);
+	if (!bAllPlayersCached || Sources.Num() == 0)
+	{
+		// A partial composite would leave a split-screen pane showing only UI, so restore the whole previous present instead.
+		FAsyncReprojectionAsyncPresent::Get().ReportCacheMiss_RenderThread();
+		const bool bRestoredFallback = TryRestorePresentFallback(GraphBuilder, BackBuffer, FallbackPlayerIndex);
+		if (bRestoredFallback)
+		{
+			FAsyncReprojectionAsyncPresent::Get().ReportCompositeSuccess_RenderThread(FPlatformTime::Seconds());
+		}
+		UE_LOG(LogAsyncReprojection, Verbose, TEXT("AsyncPresent BackBuffer warp skipped: not every local player has a cached frame (fallback restored=%d)."), bRestoredFallback ? 1 : 0);
+		return;
+	}
 
-	PassParameters->ViewRectMinAndSize = FVector4f(float(ViewRect.Min.X), float(ViewRect.Min.Y), float(ViewRect.Width()), float(ViewRect.Height()));
-	PassParameters->BufferSizeAndInvSize = FVector4f(float(CachedConstants.BufferExtent.X), float(CachedConstants.BufferExtent.Y), 1.0f / float(CachedConstants.BufferExtent.X), 1.0f / float(CachedConstants.BufferExtent.Y));
-	PassParameters->WarpWeight = Weight;
-	PassParameters->CachedInvSize = FVector2f(1.0f / float(CachedConstants.BufferExtent.X), 1.0f / float(CachedConstants.BufferExtent.Y));
-	PassParameters->UiInvSize = FVector2f(1.0f / float(BackBufferDesc.Extent.X), 1.0f / float(BackBufferDesc.Extent.Y));
-	PassParameters->UiMaskThreshold = GetAsyncPresentUiMaskThreshold();
-	PassParameters->StretchBorders = CVarState.bAsyncPresentStretchBorders ? 1u : 0u;
-	PassParameters->OcclusionFallback = CVarState.bAsyncPresentOcclusionFallback ? 1u : 0u;
-	PassParameters->DebugOverlay = CVarState.bDebugOverlay ? 1u : 0u;
-	PassParameters->RenderTargets[0] = FRenderTargetBinding(BackBufferRDG, ERenderTargetLoadAction::ELoad);
+	RDG_GPU_STAT_SCOPE(GraphBuilder, AsyncReprojectionCachedPresent);
 
-	const FScreenPassTextureViewport Viewport(ViewRect);
-	const FScreenPassViewInfo ViewInfo(CachedConstants.FeatureLevel);
+	FRDGTextureRef UiCopy = GraphBuilder.CreateTexture(BackBufferDesc, TEXT("AsyncReprojection.AsyncPresent.UiCopy"));
+	AddCopyTexturePass(GraphBuilder, BackBufferRDG, UiCopy);
 
-	AddDrawScreenPass(
-		GraphBuilder,
-		RDG_EVENT_NAME("AsyncReprojection AsyncPresent CachedWarpComposite"),
-		ViewInfo,
-		Viewport,
-		Viewport,
-		VertexShader,
-		PixelShader,
-		PassParameters,
-		EScreenPassDrawFlags::None);
+	FRDGBufferRef MetricsBuffer = FAsyncReprojectionWarpMetrics::Get().BeginPresent_RenderThread(GraphBuilder, CVarState);
+	AddCachedWarpBatchPasses(GraphBuilder, CVarState, ECachedWarpPresentPath::Composite, Sources, BackBufferRDG, UiCopy, MetricsBuffer);
+	FAsyncReprojectionWarpMetrics::Get().EndPresent_RenderThread(GraphBuilder, MetricsBuffer);
 
 	TRefCountPtr<IPooledRenderTarget> FallbackTarget;
-	if (FAsyncReprojectionFrameCache::Get().GetPresentFallbackTarget_RenderThread(PlayerIndex, FallbackTarget) && FallbackTarget.IsValid())
+	if (FAsyncReprojectionFrameCache::Get().GetPresentFallbackTarget_RenderThread(FallbackPlayerIndex, FallbackTarget) && FallbackTarget.IsValid())
 	{
 		FRDGTextureRef FallbackTargetRDG = GraphBuilder.RegisterExternalTexture(FallbackTarget, TEXT("AsyncReprojection.PresentFallbackColorRT"));
 		if (FallbackTargetRDG != nullptr && FallbackTargetRDG->Desc.Extent == BackBufferDesc.Extent && FallbackTargetRDG->Desc.Format == BackBufferDesc.Format)
 		{
 			AddCopyTexturePass(GraphBuilder, BackBufferRDG, FallbackTargetRDG);
-			FAsyncReprojectionFrameCache::Get().SetPresentFallbackValid_RenderThread(PlayerIndex, true);
+			FAsyncReprojectionFrameCache::Get().SetPresentFallbackValid_RenderThread(FallbackPlayerIndex, true);
 		}
 		else
 		{
-			FAsyncReprojectionFrameCache::Get().SetPresentFallbackValid_RenderThread(PlayerIndex, false);
+			FAsyncReprojectionFrameCache::Get().SetPresentFallbackValid_RenderThread(FallbackPlayerIndex, false);
 		}
 	}
 
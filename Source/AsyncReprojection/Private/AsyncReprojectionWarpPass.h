@@ -13,6 +13,12 @@ class FSceneView;
 class FRHIViewport;
 class FRHICommandListImmediate;
 
+struct FAsyncReprojectionCVarState;
+struct FAsyncReprojectionBenchmarkPermutation;
+struct FAsyncReprojectionBenchmarkTargets;
+struct FAsyncReprojectionBenchmarkView;
+enum class EAsyncReprojectionBenchmarkKernel : uint8;
+
 struct FAsyncReprojectionWarpPassInputs
 {
 	FScreenPassTexture SceneColor;
@@ -39,5 +45,40 @@ namespace FAsyncReprojectionBackBufferWarp
 namespace FAsyncReprojectionCachedPresentWarp
 {
 	void AddBackBufferPassIfEnabled(FRDGBuilder& GraphBuilder, SWindow& SlateWindow, FRDGTexture* BackBuffer);
-	void AddPreSlatePassIfEnabled(FRHICommandListImmediate& RHICmdList, FRHIViewport* ViewportRHI);
+
+	/** Warps every listed viewport's back buffer before Slate draws the UI, recorded into one graph for the whole present. */
+	void AddPreSlatePassesIfEnabled(FRHICommandListImmediate& RHICmdList, TConstArrayView<FRHIViewport*> Viewports);
+
+	/**
+	 * Warps the cached frames to the latest poses into a viewport's back buffer and presents it outside Slate, for the
+	 * compositor, which passes adjusted settings while it masks a hitch. Returns false, without presenting, when no
+	 * player has a usable cached frame.
+	 */
+	bool PresentCachedFrame_RenderThread(FRHICommandListImmediate& RHICmdList, FRHIViewport* ViewportRHI, const FAsyncReprojectionCVarState& CVarState, bool bLockToVsync);
+
+	/**
+	 * Warps the cached frames to the latest poses into a view family's output, under the foreground layer rendered there
+	 * (r.AsyncReprojection.Foreground). Pixels with scene depth inside a player's DepthRectByViewSlot rect keep the
+	 * foreground. Returns false, leaving the output untouched, when not every player has a usable cached frame.
+	 */
+	bool AddForegroundCompositePasses_RenderThread(
+		FRDGBuilder& GraphBuilder,
+		const FAsyncReprojectionCVarState& CVarState,
+		FRDGTextureRef ViewFamilyTexture,
+		FRDGTextureRef SceneDepth,
+		const TMap<int32, FIntRect>& DepthRectByViewSlot);
+}
+
+namespace AsyncReprojectionWarpBenchmark
+{
+	/**
+	 * Records one warp of the benchmark's synthetic frame into Targets.Output through the passes the present paths use,
+	 * with the permutation taken from Permutation instead of the CVars.
+	 */
+	void AddKernelPass(
+		FRDGBuilder& GraphBuilder,
+		EAsyncReprojectionBenchmarkKernel Kernel,
+		const FAsyncReprojectionBenchmarkPermutation& Permutation,
+		const FAsyncReprojectionBenchmarkView& View,
+		const FAsyncReprojectionBenchmarkTargets& Targets);
 }
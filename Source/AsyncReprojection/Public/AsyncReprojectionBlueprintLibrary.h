@@ -8,6 +8,8 @@
 
 #include "AsyncReprojectionBlueprintLibrary.generated.h"
 
+class UPrimitiveComponent;
+
 /**
  * @class UAsyncReprojectionBlueprintLibrary
  *
@@ -49,4 +51,14 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "AsyncReprojection", meta = (WorldContext = "WorldContextObject"))
 	static void SubmitAsyncReprojectionLatestCameraTransform(const UObject* WorldContextObject, int32 PlayerIndex, const FTransform& CameraTransform);
+
+	/**
+	 * Adds or removes the component from the foreground layer (r.AsyncReprojection.Foreground), which is rendered every
+	 * frame over the cached warp. Only components on the view target or on actors attached to it are picked up.
+	 *
+	 * @param Component Primitive component to tag, such as a first-person weapon mesh.
+	 * @param bForeground True to render the component in the foreground layer.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AsyncReprojection")
+	static void SetAsyncReprojectionForegroundComponent(UPrimitiveComponent* Component, bool bForeground);
 };
@@ -0,0 +1,96 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @struct FAsyncReprojectionPose
+ *
+ * World-space camera pose and the FPlatformTime::Seconds() it describes.
+ */
+struct FAsyncReprojectionPose
+{
+	bool bIsValid = false;
+	FTransform CameraTransform = FTransform::Identity;
+	double TimeSeconds = 0.0;
+};
+
+/**
+ * @struct FAsyncReprojectionPoseQuery
+ *
+ * What a warp knows when it asks a pose provider for the latest camera of one player.
+ */
+struct FAsyncReprojectionPoseQuery
+{
+	int32 PlayerIndex = 0;
+
+	/** FPlatformTime::Seconds() at which the warp is recorded. */
+	double TimeSeconds = 0.0;
+
+	/**
+	 * Last camera published on the game thread, from the PlayerCameraManager at the end of the frame or from
+	 * SubmitAsyncReprojectionLatestCameraTransform. Invalid until the player has a camera.
+	 */
+	FAsyncReprojectionPose Snapshot;
+
+	/** Camera velocity between the last two snapshots: rotation axis scaled by radians per second, and cm per second. */
+	FVector SnapshotAngularVelocity = FVector::ZeroVector;
+	FVector SnapshotLinearVelocity = FVector::ZeroVector;
+
+	/**
+	 * Mouse movement in pixels since Snapshot was published, and the yaw and pitch degrees per pixel from
+	 * r.AsyncReprojection.InputYawDegreesPerPixel / InputPitchDegreesPerPixel. Only tracked while
+	 * r.AsyncReprojection.InputDrivenPose or a pose provider other than the snapshot is enabled.
+	 */
+	FVector2f InputMouseDelta = FVector2f::ZeroVector;
+	FVector2f InputDegreesPerPixel = FVector2f::ZeroVector;
+
+	/** Right-stick yaw and pitch degrees (positive = right and up) turned since Snapshot was published. */
+	FVector2f InputStickDegrees = FVector2f::ZeroVector;
+
+	/** Furthest a provider should extrapolate past its newest sample (r.AsyncReprojection.PoseProvider.MaxPredictionMs). */
+	double MaxPredictionSeconds = 0.0;
+};
+
+/**
+ * @class IAsyncReprojectionPoseProvider
+ *
+ * Supplies the latest camera pose that non-stereo warps reproject to. Queried on the rendering thread each time a
+ * warp records its poses, so an implementation must be thread-safe, must not allocate or block, and should return
+ * quickly; a provider fed from its own input thread typically publishes into a TAsyncReprojectionSnapshotChannel that
+ * this call reads. Returning false, or an invalid pose, falls back to the game-thread snapshot.
+ *
+ * Built-in providers are selected with r.AsyncReprojection.PoseProvider; SetAsyncReprojectionPoseProviderOverride
+ * installs a custom one.
+ */
+class IAsyncReprojectionPoseProvider
+{
+public:
+	virtual ~IAsyncReprojectionPoseProvider() = default;
+
+	virtual const TCHAR* GetName() const = 0;
+	virtual bool GetLatestPose_RenderThread(const FAsyncReprojectionPoseQuery& Query, FAsyncReprojectionPose& OutPose) const = 0;
+
+	/**
+	 * Maps right-stick deflection to the turn rate the game applies, so input-driven warps integrate the same response
+	 * curve as the camera. Called on the game thread on every stick event while the provider is the override.
+	 *
+	 * @param PlayerIndex Local player index.
+	 * @param Deflection Stick X (positive = right) and Y (positive = up) in [-1, 1], before any dead zone.
+	 * @param OutYawPitchDegreesPerSecond Yaw and pitch turn rate (positive = right and up).
+	 * @return false to use the r.AsyncReprojection.InputStick.* curve instead.
+	 */
+	virtual bool GetStickTurnRate_GameThread(int32 PlayerIndex, const FVector2f& Deflection, FVector2f& OutYawPitchDegreesPerSecond) const
+	{
+		return false;
+	}
+};
+
+/**
+ * Replaces the built-in pose provider selection. The rendering thread keeps a reference to the provider until it is
+ * replaced, so it may be released by the caller at any time.
+ *
+ * @param PoseProvider Provider to query on the rendering thread, or nullptr to restore r.AsyncReprojection.PoseProvider.
+ */
+ASYNCREPROJECTION_API void SetAsyncReprojectionPoseProviderOverride(TSharedPtr<IAsyncReprojectionPoseProvider, ESPMode::ThreadSafe> PoseProvider);
@@ -0,0 +1,120 @@
+// Copyright © 2023–2026 Segritude Ltd. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+
+#include <atomic>
+#include <type_traits>
+
+/**
+ * @struct FAsyncReprojectionSnapshotTags
+ *
+ * Frame and time a snapshot was published at; zero until the first publish.
+ */
+struct FAsyncReprojectionSnapshotTags
+{
+	uint64 FrameCounter = 0;
+	double TimeSeconds = 0.0;
+};
+
+/**
+ * @class TAsyncReprojectionSnapshotChannel
+ *
+ * Single-writer, multi-reader latest-value channel (seqlock). The writer never waits; a reader copies the value and
+ * retries if a publish overlapped the copy, so every read returns one complete publish with its tags.
+ * Publishes from more than one thread must be serialized by the caller.
+ */
+template<typename TValue>
+class TAsyncReprojectionSnapshotChannel
+{
+	// A reader may copy a value while it is being overwritten and then discard the copy, so it must not own resources.
+	static_assert(std::is_trivially_destructible_v<TValue>, "Snapshot channel values must be plain data.");
+
+public:
+	void Publish(const TValue& InValue, uint64 FrameCounter, double TimeSeconds)
+	{
+		const uint32 Begin = Sequence.load(std::memory_order_relaxed);
+		Sequence.store(Begin + 1u, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		Value = InValue;
+		Tags.FrameCounter = FrameCounter;
+		Tags.TimeSeconds = TimeSeconds;
+
+		Sequence.store(Begin + 2u, std::memory_order_release);
+	}
+
+	/** Publishes a default value with zero tags. */
+	void Reset()
+	{
+		Publish(TValue(), 0, 0.0);
+	}
+
+	TValue Read(FAsyncReprojectionSnapshotTags* OutTags = nullptr) const
+	{
+		TValue Result;
+		FAsyncReprojectionSnapshotTags ResultTags;
+		ReadConsistent([this, &Result, &ResultTags]()
+		{
+			Result = Value;
+			ResultTags = Tags;
+		});
+
+		if (OutTags != nullptr)
+		{
+			*OutTags = ResultTags;
+		}
+		return Result;
+	}
+
+	/** Reads only the tags, for polling whether and when a value was published without copying it. */
+	FAsyncReprojectionSnapshotTags ReadTags() const
+	{
+		FAsyncReprojectionSnapshotTags ResultTags;
+		ReadConsistent([this, &ResultTags]()
+		{
+			ResultTags = Tags;
+		});
+		return ResultTags;
+	}
+
+	/** Completed publishes since construction. */
+	uint32 GetPublishCount() const
+	{
+		return Sequence.load(std::memory_order_acquire) >> 1;
+	}
+
+private:
+	template<typename TCopyFn>
+	void ReadConsistent(TCopyFn&& CopyFn) const
+	{
+		for (uint32 Attempt = 0;; Attempt++)
+		{
+			const uint32 Begin = Sequence.load(std::memory_order_acquire);
+			if ((Begin & 1u) == 0)
+			{
+				CopyFn();
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (Sequence.load(std::memory_order_relaxed) == Begin)
+				{
+					return;
+				}
+			}
+
+			// A publish is a short copy; only yield if the writer appears to have been descheduled inside one.
+			if (Attempt >= MaxSpinAttempts)
+			{
+				FPlatformProcess::YieldThread();
+			}
+		}
+	}
+
+	static constexpr uint32 MaxSpinAttempts = 64;
+
+	/** Odd while a publish is in progress. */
+	std::atomic<uint32> Sequence { 0 };
+	TValue Value {};
+	FAsyncReprojectionSnapshotTags Tags;
+};